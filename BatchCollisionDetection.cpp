@@ -0,0 +1,192 @@
+#include "BatchCollisionDetection.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define MAZER_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define MAZER_TARGET(isa)
+#else
+#define MAZER_TARGET(isa) __attribute__((target(isa)))
+#endif
+#endif
+
+namespace mazer
+{
+	namespace
+	{
+		using OverlapsFunction = std::uint64_t (*)(const SDL_Rect&, const BoundsColumns&, std::size_t, std::size_t);
+
+		bool Overlap(const SDL_Rect& bounds, const int x, const int y, const int width, const int height)
+		{
+			return width > 0 && height > 0 &&
+				x < bounds.x + bounds.w && bounds.x < x + width &&
+				y < bounds.y + bounds.h && bounds.y < y + height;
+		}
+
+		std::uint64_t ScalarOverlaps(const SDL_Rect& bounds, const BoundsColumns& batch, const std::size_t first,
+			const std::size_t count)
+		{
+			std::uint64_t mask = 0;
+			for (std::size_t i = 0; i < count; i++)
+			{
+				const auto at = first + i;
+				if (Overlap(bounds, batch.X[at], batch.Y[at], batch.Width[at], batch.Height[at]))
+				{
+					mask |= std::uint64_t{ 1 } << i;
+				}
+			}
+			return mask;
+		}
+
+#ifdef MAZER_X86
+		// The same test as Overlap, on four rectangles: x < right, left < x + width, likewise down, and not empty
+		MAZER_TARGET("sse2")
+		std::uint64_t Sse2Overlaps(const SDL_Rect& bounds, const BoundsColumns& batch, const std::size_t first,
+			const std::size_t count)
+		{
+			const auto left = _mm_set1_epi32(bounds.x);
+			const auto right = _mm_set1_epi32(bounds.x + bounds.w);
+			const auto top = _mm_set1_epi32(bounds.y);
+			const auto bottom = _mm_set1_epi32(bounds.y + bounds.h);
+			const auto zero = _mm_setzero_si128();
+
+			std::uint64_t mask = 0;
+			std::size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const auto x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(batch.X + first + i));
+				const auto y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(batch.Y + first + i));
+				const auto width = _mm_loadu_si128(reinterpret_cast<const __m128i*>(batch.Width + first + i));
+				const auto height = _mm_loadu_si128(reinterpret_cast<const __m128i*>(batch.Height + first + i));
+
+				auto hit = _mm_cmplt_epi32(x, right);
+				hit = _mm_and_si128(hit, _mm_cmpgt_epi32(_mm_add_epi32(x, width), left));
+				hit = _mm_and_si128(hit, _mm_cmplt_epi32(y, bottom));
+				hit = _mm_and_si128(hit, _mm_cmpgt_epi32(_mm_add_epi32(y, height), top));
+				hit = _mm_and_si128(hit, _mm_cmpgt_epi32(width, zero));
+				hit = _mm_and_si128(hit, _mm_cmpgt_epi32(height, zero));
+
+				mask |= static_cast<std::uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(hit))) << i;
+			}
+
+			if (i < count) { mask |= ScalarOverlaps(bounds, batch, first + i, count - i) << i; }
+			return mask;
+		}
+
+		MAZER_TARGET("avx2")
+		std::uint64_t Avx2Overlaps(const SDL_Rect& bounds, const BoundsColumns& batch, const std::size_t first,
+			const std::size_t count)
+		{
+			const auto left = _mm256_set1_epi32(bounds.x);
+			const auto right = _mm256_set1_epi32(bounds.x + bounds.w);
+			const auto top = _mm256_set1_epi32(bounds.y);
+			const auto bottom = _mm256_set1_epi32(bounds.y + bounds.h);
+			const auto zero = _mm256_setzero_si256();
+
+			std::uint64_t mask = 0;
+			std::size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				const auto x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(batch.X + first + i));
+				const auto y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(batch.Y + first + i));
+				const auto width = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(batch.Width + first + i));
+				const auto height = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(batch.Height + first + i));
+
+				// AVX2 only has greater than, so x < right is right > x
+				auto hit = _mm256_cmpgt_epi32(right, x);
+				hit = _mm256_and_si256(hit, _mm256_cmpgt_epi32(_mm256_add_epi32(x, width), left));
+				hit = _mm256_and_si256(hit, _mm256_cmpgt_epi32(bottom, y));
+				hit = _mm256_and_si256(hit, _mm256_cmpgt_epi32(_mm256_add_epi32(y, height), top));
+				hit = _mm256_and_si256(hit, _mm256_cmpgt_epi32(width, zero));
+				hit = _mm256_and_si256(hit, _mm256_cmpgt_epi32(height, zero));
+
+				mask |= static_cast<std::uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(hit))) << i;
+			}
+
+			if (i < count) { mask |= ScalarOverlaps(bounds, batch, first + i, count - i) << i; }
+			return mask;
+		}
+
+#if defined(_MSC_VER) && !defined(__clang__)
+		bool HasSse2()
+		{
+			int info[4];
+			__cpuid(info, 1);
+			return (info[3] & (1 << 26)) != 0;
+		}
+
+		bool HasAvx2()
+		{
+			int info[4];
+			__cpuid(info, 0);
+			if (info[0] < 7) { return false; }
+
+			// The operating system has to save the AVX registers too
+			__cpuid(info, 1);
+			if ((info[2] & (1 << 27)) == 0 || (_xgetbv(0) & 6) != 6) { return false; }
+
+			__cpuidex(info, 7, 0);
+			return (info[1] & (1 << 5)) != 0;
+		}
+#else
+		bool HasSse2() { return __builtin_cpu_supports("sse2"); }
+		bool HasAvx2() { return __builtin_cpu_supports("avx2"); }
+#endif
+#endif
+
+		OverlapsFunction GetOverlapsFunction(const BatchCollisionDetection::Kernel kernel)
+		{
+#ifdef MAZER_X86
+			if (kernel == BatchCollisionDetection::Kernel::Avx2) { return Avx2Overlaps; }
+			if (kernel == BatchCollisionDetection::Kernel::Sse2) { return Sse2Overlaps; }
+#endif
+			return ScalarOverlaps;
+		}
+	}
+
+	std::uint64_t BatchCollisionDetection::Overlaps(const SDL_Rect& bounds, const BoundsColumns& batch,
+		const std::size_t first, const std::size_t count)
+	{
+		static const auto best = GetOverlapsFunction(GetBestKernel());
+
+		if (bounds.w <= 0 || bounds.h <= 0) { return 0; }
+		return best(bounds, batch, first, count < MaxBatch ? count : MaxBatch);
+	}
+
+	std::uint64_t BatchCollisionDetection::Overlaps(const SDL_Rect& bounds, const BoundsColumns& batch,
+		const std::size_t first, const std::size_t count, const Kernel kernel)
+	{
+		if (bounds.w <= 0 || bounds.h <= 0) { return 0; }
+		const auto overlaps = GetOverlapsFunction(IsSupported(kernel) ? kernel : Kernel::Scalar);
+		return overlaps(bounds, batch, first, count < MaxBatch ? count : MaxBatch);
+	}
+
+	bool BatchCollisionDetection::IsSupported(const Kernel kernel)
+	{
+		switch (kernel)
+		{
+		case Kernel::Scalar: return true;
+#ifdef MAZER_X86
+		case Kernel::Sse2:
+		{
+			static const auto hasSse2 = HasSse2();
+			return hasSse2;
+		}
+		case Kernel::Avx2:
+		{
+			static const auto hasAvx2 = HasAvx2();
+			return hasAvx2;
+		}
+#endif
+		default: return false;
+		}
+	}
+
+	BatchCollisionDetection::Kernel BatchCollisionDetection::GetBestKernel()
+	{
+		if (IsSupported(Kernel::Avx2)) { return Kernel::Avx2; }
+		if (IsSupported(Kernel::Sse2)) { return Kernel::Sse2; }
+		return Kernel::Scalar;
+	}
+}
@@ -0,0 +1,81 @@
+#pragma once
+#ifndef BATCHCOLLISIONDETECTION_H
+#define BATCHCOLLISIONDETECTION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <SDL.h>
+
+namespace mazer
+{
+	// Rectangles kept as one array per field, e.g. the positions and sizes of an EnemySystem
+	struct BoundsColumns
+	{
+		const int* X = nullptr;
+		const int* Y = nullptr;
+		const int* Width = nullptr;
+		const int* Height = nullptr;
+	};
+
+	// Rectangles gathered into columns to be tested together. Clearing keeps the memory, so gathering the same number
+	// again allocates nothing
+	class BoundsBatch
+	{
+	public:
+		void Add(const SDL_Rect& bounds)
+		{
+			xs.push_back(bounds.x);
+			ys.push_back(bounds.y);
+			widths.push_back(bounds.w);
+			heights.push_back(bounds.h);
+		}
+
+		void Clear()
+		{
+			xs.clear();
+			ys.clear();
+			widths.clear();
+			heights.clear();
+		}
+
+		[[nodiscard]] std::size_t size() const { return xs.size(); }
+		[[nodiscard]] BoundsColumns GetColumns() const { return { xs.data(), ys.data(), widths.data(), heights.data() }; }
+
+	private:
+		std::vector<int> xs;
+		std::vector<int> ys;
+		std::vector<int> widths;
+		std::vector<int> heights;
+	};
+
+	/**
+	 * \brief Tests one rectangle against a batch of rectangles, several at a time.
+	 *
+	 * Gives the same answers as SDL_HasIntersection: rectangles overlap when they share some area, and empty
+	 * rectangles overlap nothing. The result is a bit mask rather than intersection rectangles. SSE2 tests four
+	 * rectangles per step and AVX2 eight. The fastest kernel the processor supports is chosen when first used,
+	 * falling back to plain C++ off x86.
+	 */
+	class BatchCollisionDetection
+	{
+	public:
+		enum class Kernel { Scalar, Sse2, Avx2 };
+
+		// Most rectangles tested by one call: one bit each in the mask
+		static constexpr std::size_t MaxBatch = 64;
+
+		// Bit i is set if the bounds overlap rectangle first + i, for count rectangles up to MaxBatch
+		static std::uint64_t Overlaps(const SDL_Rect& bounds, const BoundsColumns& batch, std::size_t first,
+			std::size_t count);
+
+		// As above with the given kernel, or plain C++ if the processor does not support it. For tests and benchmarks
+		static std::uint64_t Overlaps(const SDL_Rect& bounds, const BoundsColumns& batch, std::size_t first,
+			std::size_t count, Kernel kernel);
+
+		[[nodiscard]] static bool IsSupported(Kernel kernel);
+		[[nodiscard]] static Kernel GetBestKernel();
+	};
+}
+
+#endif
@@ -0,0 +1,205 @@
+#include "BinaryLevel.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#include "MazeGrid.h"
+
+namespace mazer
+{
+	namespace
+	{
+		constexpr std::uint64_t Alignment = 8;
+
+		std::uint64_t Align(const std::uint64_t offset) { return (offset + Alignment - 1) / Alignment * Alignment; }
+
+		std::uint64_t HorizontalWords(const int rows, const int columns)
+		{
+			return static_cast<std::uint64_t>(rows + 1) * MazeGrid::GetWordsPerRow(columns);
+		}
+
+		std::uint64_t VerticalWords(const int rows, const int columns)
+		{
+			return static_cast<std::uint64_t>(rows) * MazeGrid::GetWordsPerRow(columns + 1);
+		}
+
+		bool IsSection(const std::uint64_t offset, const std::uint64_t bytes, const std::size_t size)
+		{
+			return offset % Alignment == 0 && offset <= size && bytes <= size - offset;
+		}
+	}
+
+	BinaryLevel::BinaryLevel(const std::uint8_t* data, const std::size_t size) : data(data)
+	{
+		if (data == nullptr || size < sizeof(BinaryLevelHeader)) { return; }
+
+		const auto* candidate = reinterpret_cast<const BinaryLevelHeader*>(data);
+		if (candidate->Magic != Magic || candidate->Version != Version) { return; }
+		if (candidate->Rows <= 0 || candidate->Columns <= 0) { return; }
+
+		const auto rows = candidate->Rows;
+		const auto columns = candidate->Columns;
+		const auto valid =
+			IsSection(candidate->HorizontalWallsOffset, HorizontalWords(rows, columns) * sizeof(MazeGrid::Word), size) &&
+			IsSection(candidate->VerticalWallsOffset, VerticalWords(rows, columns) * sizeof(MazeGrid::Word), size) &&
+			IsSection(candidate->ObjectsOffset, candidate->ObjectCount * sizeof(BinaryLevelObject), size) &&
+			IsSection(candidate->PropertiesOffset, candidate->PropertyCount * sizeof(BinaryLevelProperty), size) &&
+			IsSection(candidate->StringsOffset, candidate->StringCount * sizeof(BinaryLevelString), size) &&
+			candidate->CharactersOffset <= size && candidate->CharactersSize <= size - candidate->CharactersOffset;
+
+		if (!valid) { return; }
+
+		// Objects must refer to rooms and properties that exist, so that they can be used without further checks
+		const auto* objects = reinterpret_cast<const BinaryLevelObject*>(data + candidate->ObjectsOffset);
+		for (auto i = 0u; i < candidate->ObjectCount; i++)
+		{
+			if (objects[i].Room < 0 || objects[i].Room >= rows * columns) { return; }
+			if (static_cast<std::uint64_t>(objects[i].FirstProperty) + objects[i].PropertyCount > candidate->PropertyCount) { return; }
+		}
+
+		header = candidate;
+	}
+
+	BinaryLevel::Object BinaryLevel::GetObject(const int index) const
+	{
+		const auto& object = At<BinaryLevelObject>(header->ObjectsOffset)[index];
+
+		return { object.Room, object.ResourceId, GetString(object.Name), GetString(object.Type),
+			static_cast<int>(object.FirstProperty), static_cast<int>(object.PropertyCount) };
+	}
+
+	std::pair<std::string_view, std::string_view> BinaryLevel::GetProperty(const Object& object, const int index) const
+	{
+		const auto& property = At<BinaryLevelProperty>(header->PropertiesOffset)[object.FirstProperty + index];
+
+		return { GetString(property.Key), GetString(property.Value) };
+	}
+
+	std::string_view BinaryLevel::GetString(const std::uint32_t index) const
+	{
+		if (index >= header->StringCount) { return {}; }
+
+		const auto& entry = At<BinaryLevelString>(header->StringsOffset)[index];
+		if (static_cast<std::uint64_t>(entry.Offset) + entry.Length > header->CharactersSize) { return {}; }
+
+		return { At<char>(header->CharactersOffset + entry.Offset), entry.Length };
+	}
+
+	void BinaryLevel::CopyWallsTo(MazeGrid& grid) const
+	{
+		if (grid.GetRows() != GetRows() || grid.GetColumns() != GetColumns()) { return; }
+
+		auto& horizontal = grid.GetHorizontalWords();
+		auto& vertical = grid.GetVerticalWords();
+
+		std::memcpy(horizontal.data(), data + header->HorizontalWallsOffset, horizontal.size() * sizeof(MazeGrid::Word));
+		std::memcpy(vertical.data(), data + header->VerticalWallsOffset, vertical.size() * sizeof(MazeGrid::Word));
+		grid.MarkChanged();
+	}
+
+	BinaryLevelWriter::BinaryLevelWriter(const MazeGrid& grid, const std::uint64_t seed, const bool autoPopulatePickups)
+		: grid(grid), seed(seed), autoPopulatePickups(autoPopulatePickups)
+	{
+	}
+
+	void BinaryLevelWriter::AddObject(const int room, const std::string_view name, const std::string_view type,
+		const int resourceId)
+	{
+		objects.push_back({ { room, resourceId, Intern(name), Intern(type), 0, 0 }, {} });
+	}
+
+	void BinaryLevelWriter::SetProperty(const std::string_view key, const std::string_view value)
+	{
+		if (objects.empty()) { return; }
+
+		auto& properties = objects.back().Properties;
+		const auto keyIndex = Intern(key);
+		const auto valueIndex = Intern(value);
+		const auto existing = std::find_if(properties.begin(), properties.end(),
+			[keyIndex](const BinaryLevelProperty& property) { return property.Key == keyIndex; });
+
+		if (existing != properties.end()) { existing->Value = valueIndex; }
+		else { properties.push_back({ keyIndex, valueIndex }); }
+	}
+
+	std::uint32_t BinaryLevelWriter::Intern(const std::string_view text)
+	{
+		const auto [entry, isNew] = stringIndices.try_emplace(std::string(text), static_cast<std::uint32_t>(strings.size()));
+		if (isNew)
+		{
+			strings.push_back({ static_cast<std::uint32_t>(characters.size()), static_cast<std::uint32_t>(text.size()) });
+			characters.append(text);
+		}
+		return entry->second;
+	}
+
+	void BinaryLevelWriter::Write(std::ostream& output) const
+	{
+		// Objects are stored in room order, each followed by its properties
+		std::vector<const PendingObject*> sorted;
+		sorted.reserve(objects.size());
+		for (const auto& object : objects) { sorted.push_back(&object); }
+		std::stable_sort(sorted.begin(), sorted.end(), [](const PendingObject* first, const PendingObject* second)
+		{
+			return first->Object.Room < second->Object.Room;
+		});
+
+		std::vector<BinaryLevelObject> objectTable;
+		std::vector<BinaryLevelProperty> propertyTable;
+		for (const auto* object : sorted)
+		{
+			auto entry = object->Object;
+			entry.FirstProperty = static_cast<std::uint32_t>(propertyTable.size());
+			entry.PropertyCount = static_cast<std::uint32_t>(object->Properties.size());
+			objectTable.push_back(entry);
+			propertyTable.insert(propertyTable.end(), object->Properties.begin(), object->Properties.end());
+		}
+
+		const auto& horizontal = grid.GetHorizontalWords();
+		const auto& vertical = grid.GetVerticalWords();
+
+		BinaryLevelHeader header{};
+		header.Magic = BinaryLevel::Magic;
+		header.Version = BinaryLevel::Version;
+		header.Rows = grid.GetRows();
+		header.Columns = grid.GetColumns();
+		header.Seed = seed;
+		header.Flags = autoPopulatePickups ? BinaryLevel::AutoPopulatePickupsFlag : 0u;
+		header.ObjectCount = static_cast<std::uint32_t>(objectTable.size());
+		header.PropertyCount = static_cast<std::uint32_t>(propertyTable.size());
+		header.StringCount = static_cast<std::uint32_t>(strings.size());
+		header.HorizontalWallsOffset = Align(sizeof(BinaryLevelHeader));
+		header.VerticalWallsOffset = Align(header.HorizontalWallsOffset + horizontal.size() * sizeof(MazeGrid::Word));
+		header.ObjectsOffset = Align(header.VerticalWallsOffset + vertical.size() * sizeof(MazeGrid::Word));
+		header.PropertiesOffset = Align(header.ObjectsOffset + objectTable.size() * sizeof(BinaryLevelObject));
+		header.StringsOffset = Align(header.PropertiesOffset + propertyTable.size() * sizeof(BinaryLevelProperty));
+		header.CharactersOffset = Align(header.StringsOffset + strings.size() * sizeof(BinaryLevelString));
+		header.CharactersSize = characters.size();
+
+		std::uint64_t written = 0;
+		auto writeSection = [&](const std::uint64_t offset, const void* bytes, const std::size_t count)
+		{
+			static constexpr char padding[Alignment] = {};
+			output.write(padding, static_cast<std::streamsize>(offset - written));
+			output.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(count));
+			written = offset + count;
+		};
+
+		writeSection(0, &header, sizeof(header));
+		writeSection(header.HorizontalWallsOffset, horizontal.data(), horizontal.size() * sizeof(MazeGrid::Word));
+		writeSection(header.VerticalWallsOffset, vertical.data(), vertical.size() * sizeof(MazeGrid::Word));
+		writeSection(header.ObjectsOffset, objectTable.data(), objectTable.size() * sizeof(BinaryLevelObject));
+		writeSection(header.PropertiesOffset, propertyTable.data(), propertyTable.size() * sizeof(BinaryLevelProperty));
+		writeSection(header.StringsOffset, strings.data(), strings.size() * sizeof(BinaryLevelString));
+		writeSection(header.CharactersOffset, characters.data(), characters.size());
+	}
+
+	bool BinaryLevelWriter::Save(const std::string& fileName) const
+	{
+		std::ofstream output(fileName, std::ios::binary | std::ios::trunc);
+		if (!output) { return false; }
+
+		Write(output);
+		return static_cast<bool>(output);
+	}
+}
@@ -0,0 +1,157 @@
+#pragma once
+#ifndef BINARYLEVEL_H
+#define BINARYLEVEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace mazer
+{
+	class MazeGrid;
+
+	/*
+	 * Binary level file (.mzl) layout. All values are little-endian and every section starts on an 8 byte boundary,
+	 * so a mapped file can be used in place:
+	 *
+	 *   BinaryLevelHeader
+	 *   horizontal wall plane    (rows + 1) x MazeGrid::GetWordsPerRow(columns) words
+	 *   vertical wall plane      rows x MazeGrid::GetWordsPerRow(columns + 1) words
+	 *   BinaryLevelObject[]      sorted by room
+	 *   BinaryLevelProperty[]    the properties of each object are contiguous
+	 *   BinaryLevelString[]      each distinct string once
+	 *   characters               the text of the strings, not null terminated
+	 */
+	struct BinaryLevelHeader
+	{
+		std::uint32_t Magic;
+		std::uint32_t Version;
+		std::int32_t Rows;
+		std::int32_t Columns;
+		std::uint64_t Seed;
+		std::uint32_t Flags;
+		std::uint32_t ObjectCount;
+		std::uint32_t PropertyCount;
+		std::uint32_t StringCount;
+		std::uint64_t HorizontalWallsOffset;
+		std::uint64_t VerticalWallsOffset;
+		std::uint64_t ObjectsOffset;
+		std::uint64_t PropertiesOffset;
+		std::uint64_t StringsOffset;
+		std::uint64_t CharactersOffset;
+		std::uint64_t CharactersSize;
+	};
+
+	struct BinaryLevelObject
+	{
+		std::int32_t Room;
+		std::int32_t ResourceId;
+		std::uint32_t Name; // string index
+		std::uint32_t Type; // string index
+		std::uint32_t FirstProperty;
+		std::uint32_t PropertyCount;
+	};
+
+	struct BinaryLevelProperty
+	{
+		std::uint32_t Key; // string index
+		std::uint32_t Value; // string index
+	};
+
+	struct BinaryLevelString
+	{
+		std::uint32_t Offset; // into the characters
+		std::uint32_t Length;
+	};
+
+	/**
+	 * \brief Read-only view of a binary level held in memory, usually a MappedFile.
+	 *
+	 * Nothing is parsed or copied: the header is validated once and everything else is read in place.
+	 */
+	class BinaryLevel
+	{
+	public:
+		static constexpr std::uint32_t Magic = 0x314C5A4D; // "MZL1"
+		static constexpr std::uint32_t Version = 1;
+		static constexpr std::uint32_t AutoPopulatePickupsFlag = 1u;
+		static constexpr std::string_view FileExtension = ".mzl";
+
+		struct Object
+		{
+			int Room;
+			int ResourceId;
+			std::string_view Name;
+			std::string_view Type;
+			int FirstProperty;
+			int PropertyCount;
+		};
+
+		BinaryLevel(const std::uint8_t* data, std::size_t size);
+
+		// False if the data is not a binary level of a version this code can read
+		[[nodiscard]] bool IsValid() const { return header != nullptr; }
+
+		[[nodiscard]] int GetRows() const { return header->Rows; }
+		[[nodiscard]] int GetColumns() const { return header->Columns; }
+		// 0 if the level has no seed
+		[[nodiscard]] std::uint64_t GetSeed() const { return header->Seed; }
+		[[nodiscard]] bool IsAutoPopulatePickups() const { return header->Flags & AutoPopulatePickupsFlag; }
+		[[nodiscard]] int GetObjectCount() const { return static_cast<int>(header->ObjectCount); }
+
+		[[nodiscard]] Object GetObject(int index) const;
+		[[nodiscard]] std::pair<std::string_view, std::string_view> GetProperty(const Object& object, int index) const;
+		[[nodiscard]] std::string_view GetString(std::uint32_t index) const;
+
+		// Copies the wall planes into a grid of the same size
+		void CopyWallsTo(MazeGrid& grid) const;
+
+	private:
+		template <typename T>
+		const T* At(const std::uint64_t offset) const { return reinterpret_cast<const T*>(data + offset); }
+
+		const std::uint8_t* data;
+		const BinaryLevelHeader* header = nullptr;
+	};
+
+	/**
+	 * \brief Builds a binary level from a grid and the objects in its rooms
+	 */
+	class BinaryLevelWriter
+	{
+	public:
+		BinaryLevelWriter(const MazeGrid& grid, std::uint64_t seed, bool autoPopulatePickups);
+
+		void AddObject(int room, std::string_view name, std::string_view type, int resourceId);
+
+		// Sets a property of the last object added. As when loading XML, a key set twice keeps the last value.
+		void SetProperty(std::string_view key, std::string_view value);
+
+		void Write(std::ostream& output) const;
+		bool Save(const std::string& fileName) const;
+
+	private:
+		struct PendingObject
+		{
+			BinaryLevelObject Object;
+			std::vector<BinaryLevelProperty> Properties;
+		};
+
+		std::uint32_t Intern(std::string_view text);
+
+		const MazeGrid& grid;
+		std::uint64_t seed;
+		bool autoPopulatePickups;
+		std::vector<PendingObject> objects;
+		std::vector<BinaryLevelString> strings;
+		std::string characters;
+		std::unordered_map<std::string, std::uint32_t> stringIndices;
+	};
+}
+
+#endif
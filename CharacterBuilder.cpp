@@ -1,7 +1,6 @@
 #include "CharacterBuilder.h"
 #include <asset/SpriteAsset.h>
 #include <common/constants.h>
-#include <events/PlayerMovedEvent.h>
 #include <objects/GameObjectFactory.h>
 #include <utils/Utils.h>
 
@@ -19,7 +18,7 @@ namespace mazer
 
 	std::shared_ptr<Player> CharacterBuilder::BuildPlayer(const std::string& playerName,
 		const std::shared_ptr<Room>& playerRoom,
-		const int playerResourceId, const std::string& nickName)
+		const int playerResourceId, const std::string& nickName, World& world)
 	{
 		// The player's sprite sheet
 		const auto spriteAsset = To<SpriteAsset>(ResourceManager::Get()->GetAssetInfo(playerResourceId));
@@ -40,7 +39,8 @@ namespace mazer
 			"Player",
 			playerRoom,
 			spriteAsset->Dimensions,
-			nickName);
+			nickName,
+			world);
 
 		// Initialize player
 		player->LoadSettings();
@@ -49,15 +49,15 @@ namespace mazer
 		player->SetSprite(animatedSprite);
 		player->IntProperties["Health"] = 100;
 
-		// We keep a reference to track of the player globally
-		GameData::Get()->player = player;
+		// The world keeps track of its player
+		world.Data().SetPlayer(player);
 
 		return player;
 	}
 
 	std::shared_ptr<Enemy> CharacterBuilder::BuildEnemy(const std::string& enemyName, const std::shared_ptr<Room>& enemyRoom,
 		const int enemySpriteResourceId, gamelib::Direction startingDirection,
-		const std::shared_ptr<const Level>& level)
+		const std::shared_ptr<const Level>& level, World& world)
 	{
 		// A enemy's sprite asset
 		const auto spriteAsset = To<SpriteAsset>(ResourceManager::Get()->GetAssetInfo(enemySpriteResourceId));
@@ -79,7 +79,9 @@ namespace mazer
 			enemyRoom,
 			enemyAnimatedSprite,
 			startingDirection,
-			level);
+			level,
+			nullptr,
+			world);
 
 		return enemy;
 	}
@@ -87,7 +89,7 @@ namespace mazer
 
 	std::shared_ptr<mazer::Pickup> CharacterBuilder::BuildPickup(const std::string& pickupName,
 		const std::shared_ptr<Room>& pickupRoom,
-		const int pickupResourceId)
+		const int pickupResourceId, World& world)
 	{
 		const auto pickupSpriteSheet = To<SpriteAsset>(ResourceManager::Get()->GetAssetInfo(pickupResourceId));
 
@@ -97,11 +99,11 @@ namespace mazer
 			positionInRoom,
 			true,
 			pickupRoom->GetRoomNumber(),
-			pickupSpriteSheet);
+			pickupSpriteSheet,
+			world);
 
 		pickup->Initialize();
 		pickup->LoadSettings();
-		pickup->SubscribeToEvent(PlayerMovedEventTypeEventId);
 		return pickup;
 	}
 }
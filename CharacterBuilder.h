@@ -2,6 +2,7 @@
 #include <memory>
 
 #include "resource/ResourceManager.h"
+#include "World.h"
 
 
 namespace gamelib
@@ -20,22 +21,26 @@ namespace mazer
 
 	class Pickup;
 
+	// Builds the characters of a world. The player built becomes the player of the world
 	class CharacterBuilder
 	{
 	public:
 		static std::shared_ptr<Player> BuildPlayer(const std::string& playerName,
 			const std::shared_ptr<Room>& playerRoom,
 			int playerResourceId,
-			const std::string& nickName);
+			const std::string& nickName,
+			World& world = World::Default());
 
 		static std::shared_ptr<mazer::Pickup> BuildPickup(const std::string& pickupName,
 			const std::shared_ptr<Room>& pickupRoom,
-			int pickupResourceId);
+			int pickupResourceId,
+			World& world = World::Default());
 
 		static std::shared_ptr<Enemy> BuildEnemy(const std::string& enemyName, const std::shared_ptr<Room>& enemyRoom,
 			int enemySpriteResourceId,
 			gamelib::Direction startingDirection,
 			const std::shared_ptr<const Level>&
-			level);
+			level,
+			World& world = World::Default());
 	};
 }
@@ -0,0 +1,83 @@
+#include "CorridorSegments.h"
+
+#include "MazeGrid.h"
+
+using namespace gamelib;
+
+namespace mazer
+{
+	void CorridorSegments::Build(const std::shared_ptr<const MazeGrid>& grid)
+	{
+		this->grid = grid;
+		rowSegments.assign(grid->GetRoomCount(), -1);
+		columnSegments.assign(grid->GetRoomCount(), -1);
+
+		for (auto index = 0; index < grid->GetRoomCount(); index++)
+		{
+			// A room starts a new segment unless it is open to the room before it
+			const auto column = grid->GetColumn(index);
+			rowSegments[index] = column > 0 && !grid->IsWalled(index, Side::Left) ? rowSegments[index - 1] : index;
+
+			const auto row = grid->GetRow(index);
+			const auto above = index - grid->GetColumns();
+			columnSegments[index] = row > 0 && !grid->IsWalled(index, Side::Top) ? columnSegments[above] : index;
+		}
+	}
+
+	void CorridorSegments::OnWallChanged(const MazeGrid& changed, const int index, const Side side)
+	{
+		if (!IsTracking(changed) || !changed.IsValidIndex(index)) { return; }
+
+		const auto neighbor = changed.GetNeighborIndex(index, side);
+		if (neighbor < 0) { return; }
+
+		// Only the rooms from the far side of the wall to the end of their segment change label: they join the
+		// segment before the wall if it is now open, or start their own if it is now closed
+		const auto before = neighbor < index ? neighbor : index;
+		const auto after = neighbor < index ? index : neighbor;
+		const auto horizontal = side == Side::Left || side == Side::Right;
+		auto& segments = horizontal ? rowSegments : columnSegments;
+		const auto step = horizontal ? Side::Right : Side::Bottom;
+		const auto label = changed.IsWalled(before, step) ? after : segments[before];
+
+		Label(segments, after, label, step);
+	}
+
+	void CorridorSegments::Label(std::vector<int>& segments, const int first, const int label, const Side side) const
+	{
+		for (auto room = first; room >= 0; room = grid->GetNeighborIndex(room, side))
+		{
+			segments[room] = label;
+			if (grid->IsWalled(room, side)) { break; }
+		}
+	}
+
+	void CorridorSegments::Clear()
+	{
+		grid.reset();
+		rowSegments.clear();
+		columnSegments.clear();
+	}
+
+	bool CorridorSegments::CanSee(const int from, const int to) const
+	{
+		if (from == to || GetRowSegment(from) < 0 || GetRowSegment(to) < 0) { return false; }
+
+		return rowSegments[from] == rowSegments[to] || columnSegments[from] == columnSegments[to];
+	}
+
+	bool CorridorSegments::CanSee(const int from, const int to, const Direction direction) const
+	{
+		if (!CanSee(from, to)) { return false; }
+
+		// Labels are the first room of a segment, so sharing one means sharing the row or the column
+		switch (direction)
+		{
+		case Direction::Up: return columnSegments[from] == columnSegments[to] && to < from;
+		case Direction::Down: return columnSegments[from] == columnSegments[to] && to > from;
+		case Direction::Left: return rowSegments[from] == rowSegments[to] && to < from;
+		case Direction::Right: return rowSegments[from] == rowSegments[to] && to > from;
+		default: return false;
+		}
+	}
+}
@@ -0,0 +1,62 @@
+#pragma once
+#ifndef CORRIDORSEGMENTS_H
+#define CORRIDORSEGMENTS_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <cppgamelib/character/Direction.h>
+#include <cppgamelib/geometry/Side.h>
+
+namespace mazer
+{
+	class MazeGrid;
+
+	/**
+	 * \brief Labels the straight corridors of a maze, so that whether one room can be seen from another is a compare.
+	 *
+	 * A row segment is a run of rooms in a row with no wall between them, a column segment the same down a column.
+	 * Each room carries the label of both its segments, the index of the first room of the segment, so two rooms
+	 * see each other when they share a label. Labels are built once for a grid and patched along the one segment a
+	 * wall change affects.
+	 */
+	class CorridorSegments
+	{
+	public:
+		void Build(const std::shared_ptr<const MazeGrid>& grid);
+
+		// The wall on the given side of a room has been added or removed. Ignored unless it is the grid of the labels
+		void OnWallChanged(const MazeGrid& changed, int index, gamelib::Side side);
+
+		void Clear();
+
+		[[nodiscard]] bool IsTracking(const MazeGrid& other) const { return grid.get() == &other; }
+
+		// Labels of the segments of a room, or -1 for a room not in the grid
+		[[nodiscard]] int GetRowSegment(const int index) const
+		{
+			return static_cast<std::size_t>(index) < rowSegments.size() ? rowSegments[index] : -1;
+		}
+
+		[[nodiscard]] int GetColumnSegment(const int index) const
+		{
+			return static_cast<std::size_t>(index) < columnSegments.size() ? columnSegments[index] : -1;
+		}
+
+		// Whether nothing blocks the view between two different rooms along a row or a column
+		[[nodiscard]] bool CanSee(int from, int to) const;
+
+		// Whether the other room is further along the direction with nothing in between
+		[[nodiscard]] bool CanSee(int from, int to, gamelib::Direction direction) const;
+
+	private:
+		// Relabels the rooms of the segment that starts at a room, stepping through the given side
+		void Label(std::vector<int>& segments, int first, int label, gamelib::Side side) const;
+
+		std::shared_ptr<const MazeGrid> grid;
+		std::vector<int> rowSegments;
+		std::vector<int> columnSegments;
+	};
+}
+
+#endif
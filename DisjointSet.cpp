@@ -0,0 +1,35 @@
+#include "DisjointSet.h"
+#include <numeric>
+#include <utility>
+
+namespace mazer
+{
+	DisjointSet::DisjointSet(const int size) : setCount(0)
+	{
+		Reset(size);
+	}
+
+	void DisjointSet::Reset(const int size)
+	{
+		parent.resize(size);
+		rank.assign(size, 0);
+		std::iota(parent.begin(), parent.end(), 0);
+		setCount = size;
+	}
+
+	bool DisjointSet::Union(const int first, const int second)
+	{
+		auto firstRoot = Find(first);
+		auto secondRoot = Find(second);
+
+		if (firstRoot == secondRoot) { return false; }
+
+		// Hang the shallower tree off the deeper one
+		if (rank[firstRoot] < rank[secondRoot]) { std::swap(firstRoot, secondRoot); }
+		parent[secondRoot] = firstRoot;
+		if (rank[firstRoot] == rank[secondRoot]) { rank[firstRoot]++; }
+
+		setCount--;
+		return true;
+	}
+}
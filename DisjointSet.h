@@ -0,0 +1,48 @@
+#pragma once
+#ifndef DISJOINTSET_H
+#define DISJOINTSET_H
+
+#include <cstdint>
+#include <vector>
+
+namespace mazer
+{
+	/**
+	 * \brief Union-find over the elements [0, size) with path compression and union by rank.
+	 *
+	 * Find and Union run in near-constant amortised time, so connecting n rooms is near-linear in n.
+	 */
+	class DisjointSet
+	{
+	public:
+		explicit DisjointSet(int size = 0);
+
+		// Puts every element back into its own set, reusing the existing storage where possible
+		void Reset(int size);
+
+		[[nodiscard]] int Find(int element)
+		{
+			// Path halving: point every other element on the path at its grandparent
+			while (parent[element] != element)
+			{
+				parent[element] = parent[parent[element]];
+				element = parent[element];
+			}
+			return element;
+		}
+
+		// Joins the sets of the two elements, returns false if they were already in the same set
+		bool Union(int first, int second);
+
+		[[nodiscard]] bool IsSameSet(const int first, const int second) { return Find(first) == Find(second); }
+		[[nodiscard]] int GetSize() const { return static_cast<int>(parent.size()); }
+		[[nodiscard]] int GetSetCount() const { return setCount; }
+
+	private:
+		std::vector<int> parent;
+		std::vector<std::uint8_t> rank;
+		int setCount;
+	};
+}
+
+#endif
@@ -7,9 +7,15 @@ namespace mazer
 	class ElapsedGameTimeProvider : public gamelib::IElapsedTimeProvider
 	{
 	public:
+		explicit ElapsedGameTimeProvider(GameDataManager* gameDataManager = GameDataManager::Get())
+			: gameDataManager(gameDataManager) {}
+
 		int GetElapsedTime() override
 		{
-			return static_cast<int>(GameDataManager::Get()->GameWorldData.ElapsedGameTime) / 1000;
+			return static_cast<int>(gameDataManager->GameWorldData.ElapsedGameTime) / 1000;
 		}
+
+	private:
+		GameDataManager* gameDataManager;
 	};
 }
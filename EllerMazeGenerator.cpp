@@ -0,0 +1,128 @@
+#include "EllerMazeGenerator.h"
+#include <vector>
+
+#include "DisjointSet.h"
+#include "MazeGrid.h"
+#include "MazeGridRowSink.h"
+#include "MazeRow.h"
+#include "RandomStream.h"
+
+namespace mazer
+{
+	namespace
+	{
+		// Hands out random bits one at a time from 64 bit draws
+		class CoinFlipper
+		{
+		public:
+			explicit CoinFlipper(const std::uint64_t seed) : random(seed) {}
+
+			bool Flip()
+			{
+				if (remaining == 0)
+				{
+					bits = random();
+					remaining = 64;
+				}
+				const auto result = bits & 1u;
+				bits >>= 1;
+				remaining--;
+				return result;
+			}
+
+		private:
+			RandomStream random;
+			std::uint64_t bits = 0;
+			int remaining = 0;
+		};
+	}
+
+	EllerMazeGenerator::EllerMazeGenerator(const int rows, const int columns, const std::uint64_t seed)
+		: rows(rows), columns(columns), seed(seed)
+	{
+	}
+
+	void EllerMazeGenerator::Generate(IMazeRowSink& sink) const
+	{
+		// A maze without rooms has no rows to send
+		if (rows <= 0 || columns <= 0) { return; }
+
+		constexpr auto noSet = -1;
+		CoinFlipper coin(seed);
+		MazeRow row(columns);
+
+		// The set each room of the current row belongs to. Sets are labelled with column numbers so that the
+		// union-find over a row never needs more than 'columns' elements
+		std::vector<int> sets(columns, noSet);
+		std::vector<int> nextSets(columns);
+		std::vector<int> roomsLeftInSet(columns);
+		std::vector<std::uint8_t> setGoesDown(columns);
+		std::vector<std::uint8_t> labelInUse(columns);
+		DisjointSet rowSets(columns);
+
+		sink.OnBegin(rows, columns);
+
+		for (auto rowNumber = 0; rowNumber < rows; rowNumber++)
+		{
+			const auto isLastRow = rowNumber == rows - 1;
+			row.Row = rowNumber;
+
+			// Rooms not joined to the row above start in a set of their own
+			std::fill(labelInUse.begin(), labelInUse.end(), false);
+			for (const auto set : sets) { if (set != noSet) { labelInUse[set] = true; } }
+
+			auto freeLabel = 0;
+			for (auto& set : sets)
+			{
+				if (set != noSet) { continue; }
+				while (labelInUse[freeLabel]) { freeLabel++; }
+				set = freeLabel++;
+			}
+
+			rowSets.Reset(columns);
+
+			// Randomly join adjacent rooms that are not already connected. The last row joins them all.
+			for (auto column = 0; column < columns - 1; column++)
+			{
+				const auto join = !rowSets.IsSameSet(sets[column], sets[column + 1]) && (isLastRow || coin.Flip());
+				if (join) { rowSets.Union(sets[column], sets[column + 1]); }
+				row.SetRightWall(column, !join);
+			}
+			row.SetRightWall(columns - 1, true);
+
+			// Each set must continue into the next row through at least one room
+			std::fill(roomsLeftInSet.begin(), roomsLeftInSet.end(), 0);
+			std::fill(setGoesDown.begin(), setGoesDown.end(), false);
+			for (auto& set : sets)
+			{
+				set = rowSets.Find(set);
+				roomsLeftInSet[set]++;
+			}
+
+			for (auto column = 0; column < columns; column++)
+			{
+				const auto set = sets[column];
+				const auto goDown = !isLastRow && (coin.Flip() || (roomsLeftInSet[set] == 1 && !setGoesDown[set]));
+
+				roomsLeftInSet[set]--;
+				if (goDown) { setGoesDown[set] = true; }
+				row.SetBottomWall(column, !goDown);
+				nextSets[column] = goDown ? set : noSet;
+			}
+
+			sink.OnRow(row);
+			sets.swap(nextSets);
+		}
+
+		sink.OnEnd();
+	}
+
+	std::shared_ptr<MazeGrid> EllerMazeGenerator::GenerateGrid() const
+	{
+		auto grid = std::make_shared<MazeGrid>(rows, columns);
+		MazeGridRowSink sink(*grid);
+		Generate(sink);
+		grid->MarkChanged();
+		return grid;
+	}
+}
@@ -0,0 +1,37 @@
+#pragma once
+#ifndef ELLERMAZEGENERATOR_H
+#define ELLERMAZEGENERATOR_H
+
+#include <cstdint>
+#include <memory>
+
+namespace mazer
+{
+	class IMazeRowSink;
+	class MazeGrid;
+
+	/**
+	 * \brief Generates a perfect maze one row at a time using Eller's algorithm.
+	 *
+	 * Only the current row is kept in memory, so the memory used is proportional to the number of columns and not
+	 * to the size of the maze. Every room is reachable from every other room by exactly one path.
+	 */
+	class EllerMazeGenerator
+	{
+	public:
+		EllerMazeGenerator(int rows, int columns, std::uint64_t seed);
+
+		// Streams the maze to the sink, top row first
+		void Generate(IMazeRowSink& sink) const;
+
+		// Generates the whole maze into a new grid
+		[[nodiscard]] std::shared_ptr<MazeGrid> GenerateGrid() const;
+
+	private:
+		int rows;
+		int columns;
+		std::uint64_t seed;
+	};
+}
+
+#endif
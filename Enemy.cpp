@@ -3,12 +3,13 @@
 #include <utility>
 
 #include "RoomInfo.h"
+#include "GameData.h"
+#include <cppgamelib/events/EventManager.h>
 #include "cppgamelib/ai/FSM.h"
 #include <cppgamelib/character/MovementAtSpeed.h>
 #include "Room.h"
+#include "MazerSettings.h"
 #include <cppgamelib/character/Movement.h>
-#include <cppgamelib/events/PlayerMovedEvent.h>
-#include <cppgamelib/file/SettingsManager.h>
 #include <cppgamelib/geometry/SideUtils.h>
 #include "Level.h"
 #include "EnemyMovedEvent.h"
@@ -19,6 +20,7 @@
 #include "cppgamelib/ai/InlineAction.h"
 #include "Player.h"
 #include "PlayerCollidedWithEnemyEvent.h"
+#include "PooledEvents.h"
 #include "SDLCollisionDetection.h"
 #include "cppgamelib/character/Hotspot.h"
 #include "cppgamelib/graphic/DrawableText.h"
@@ -34,13 +36,14 @@ namespace mazer
 		std::shared_ptr<gamelib::AnimatedSprite> sprite,
 		const gamelib::Direction startingDirection,
 		std::shared_ptr<const Level> level,
-		std::shared_ptr<gamelib::IGameObjectMoveStrategy> enemyMoveStrategy)
+		std::shared_ptr<gamelib::IGameObjectMoveStrategy> enemyMoveStrategy,
+		World& world)
 		: Npc(name, type, position, visible, std::move(sprite), std::move(enemyMoveStrategy)),
-		CurrentLevel(std::move(level))
+		CurrentLevel(std::move(level)), world(&world)
 	{
 		Npc::SetDirection(startingDirection);
 
-		CurrentRoom = std::make_shared<RoomInfo>(startRoom);
+		CurrentRoom = std::make_shared<RoomInfo>(startRoom, world);
 	}
 
 	void Enemy::ConfigureEnemyBehavior()
@@ -148,11 +151,9 @@ namespace mazer
 	void Enemy::Initialize()
 	{
 		LoadSettings();
-		SubscribeToEvent(gamelib::PlayerMovedEventTypeEventId);
-		SubscribeToEvent(SettingsReloadedEventId);
 
 		// Save some frames: don't move every frame. E.g., move every 10ms
-		moveTimer.SetFrequency(moveRateMs);
+		moveTimer.SetFrequency(settings->Enemy.MoveRateMs);
 
 		// Use or create a move strategy. 
 		gameObjectMoveStrategy = gameObjectMoveStrategy == nullptr
@@ -165,41 +166,33 @@ namespace mazer
 
 	void Enemy::LoadSettings()
 	{
-		emitMoveEvents = gamelib::SettingsManager::Bool("enemy", "emitMoveEvents");
-		moveAtSpeed = gamelib::SettingsManager::Bool("enemy", "moveAtSpeed");
-		speed = gamelib::SettingsManager::Int("enemy", "speed");
-		moveRateMs = gamelib::SettingsManager::Int("enemy", "moveRateMs");
-		animate = gamelib::SettingsManager::Bool("enemy", "animate");
-
-		// This draw's the enemies state-machine state near/over the enemy itself
-		drawState = gamelib::SettingsManager::Bool("enemy", "drawState");
+		settings.Load();
 
 		// Use behavior tree or use Finite state machine
-		useBehaviorTree = gamelib::SettingsManager::Bool("enemy", "useBehaviorTree");
+		useBehaviorTree = settings->Enemy.UseBehaviorTree;
 	}
 
 	std::vector<std::shared_ptr<gamelib::Event>> Enemy::HandleEvent(const std::shared_ptr<gamelib::Event>& event,
 		const unsigned long deltaMs)
 	{
-		// Only if the player moves...
-		if (event->Id == gamelib::PlayerMovedEventTypeEventId)
-		{
-			CheckForPlayerCollision();
-		}
-
-		// Only if settings event occurs
-		if (event->Id.PrimaryId == SettingsReloadedEventId.PrimaryId)
-		{
-			LoadSettings();
-		}
-
+		// The player finds the enemies it touches when it moves, from the enemies in its rooms
 		return {};
 	}
 
 	void Enemy::Update(const unsigned long deltaMs)
 	{
-		if (GameData::Get()->IsGameWon())
+		if (world->Data().IsGameWon())
+		{
+			return;
+		}
+
+		// Settings are read where they are used, only the move timer needs telling about a reload
+		if (settings.Refresh()) { moveTimer.SetFrequency(settings->Enemy.MoveRateMs); }
+
+		// The enemy system has moved the enemy already
+		if (enemySystem != nullptr)
 		{
+			Npc::Update(deltaMs);
 			return;
 		}
 
@@ -236,7 +229,7 @@ namespace mazer
 
 			// Show the current state of the FSM on the enemy
 			auto constexpr emptyString = "";
-			auto stateText = drawState
+			auto stateText = settings->Enemy.DrawState
 				? stateMachine.ActiveState->GetName().substr(0, 1)
 				: emptyString;
 
@@ -249,24 +242,30 @@ namespace mazer
 
 	bool Enemy::Move(const unsigned long deltaMs)
 	{
-		const std::shared_ptr<gamelib::IMovement> movementAtSpeed = std::make_shared<gamelib::MovementAtSpeed>(speed, currentFacingDirection, deltaMs);
-		const std::shared_ptr<gamelib::IMovement> constantPixelMovement = std::make_shared<gamelib::Movement>(currentFacingDirection);
-
-		// Move the game object a bit
-		isValidMove = gameObjectMoveStrategy->MoveGameObject(moveAtSpeed
-			? movementAtSpeed
-			: constantPixelMovement);
+		// Move the game object a bit, by a movement on the stack rather than the heap
+		if (settings->Enemy.MoveAtSpeed)
+		{
+			gamelib::MovementAtSpeed movementAtSpeed(settings->Enemy.Speed, currentFacingDirection, deltaMs);
+			isValidMove = GameObjectMoveStrategy::MoveGameObject(*gameObjectMoveStrategy, movementAtSpeed);
+		}
+		else
+		{
+			gamelib::Movement constantPixelMovement(currentFacingDirection);
+			isValidMove = GameObjectMoveStrategy::MoveGameObject(*gameObjectMoveStrategy, constantPixelMovement);
+		}
 
 		if (isValidMove)
 		{
+			UpdateCurrentRoom();
+
 			// Tell the world I moved
 
-			if (!emitMoveEvents)
+			if (!settings->Enemy.EmitMoveEvents)
 			{
 				return true;
 			}
 
-			EventSubscriber::RaiseEvent(std::make_shared<EnemyMovedEvent>(shared_from_this()));
+			world->Events().RaiseEvent(world->Pools().MakeEnemyMovedEvent(shared_from_this()), this);
 
 			return true;
 		}
@@ -274,6 +273,42 @@ namespace mazer
 		return false;
 	}
 
+	EnemyPlacement Enemy::GetPlacement() const
+	{
+		const auto hotspot = TheHotspot->GetBounds();
+		EnemyPlacement placement;
+		placement.X = Position.GetX();
+		placement.Y = Position.GetY();
+		placement.Width = Bounds.w;
+		placement.Height = Bounds.h;
+		placement.HotspotX = hotspot.x + hotspot.w / 2 - placement.X;
+		placement.HotspotY = hotspot.y + hotspot.h / 2 - placement.Y;
+		placement.Direction = currentFacingDirection;
+		return placement;
+	}
+
+	void Enemy::SetPlacement(const EnemyPlacement& placement)
+	{
+		Position.SetX(placement.X);
+		Position.SetY(placement.Y);
+		Bounds.x = placement.X;
+		Bounds.y = placement.Y;
+		TheHotspot->Update(Position);
+		SetDirection(placement.Direction);
+		UpdateCurrentRoom();
+	}
+
+	void Enemy::UpdateCurrentRoom() const
+	{
+		// The room follows the hotspot, and the game data keeps the enemy with the other enemies in that room
+		const auto from = CurrentRoom->RoomIndex;
+		const auto hotspot = TheHotspot->GetBounds();
+		if (CurrentRoom->UpdateCurrentRoom(hotspot.x + hotspot.w / 2, hotspot.y + hotspot.h / 2))
+		{
+			world->Data().OnEnemyChangedRoom(*this, from);
+		}
+	}
+
 	std::function<bool()> Enemy::IfMovedInDirection(const gamelib::Direction direction) const
 	{
 		// note: returns a func
@@ -313,8 +348,14 @@ namespace mazer
 	{
 		// Most enemy states use this state
 
+		if (settings->Enemy.ChaseByFlowField)
+		{
+			ChasePlayer();
+			return;
+		}
+
 		// Get player details
-		const auto player = GameData::Get()->GetPlayer();
+		const auto player = world->Data().GetPlayer();
 		const auto playerRow = player->CurrentRoom->GetCurrentRoom()->GetRowNumber(CurrentLevel->NumRows);
 		const auto playerCol = player->CurrentRoom->GetCurrentRoom()->GetColumnNumber(CurrentLevel->NumCols);
 
@@ -384,6 +425,24 @@ namespace mazer
 		}
 	}
 
+	void Enemy::ChasePlayer()
+	{
+		// The flow field is rooted at the player's room, so the way there is one read whatever the number of enemies
+		const auto& flowField = world->Data().GetFlowField();
+		const auto room = CurrentRoom->RoomIndex;
+
+		if (flowField.GetDistance(room) == 0)
+		{
+			CheckForPlayerCollision();
+			return;
+		}
+
+		if (const auto direction = flowField.GetDirection(room); direction != gamelib::Direction::None)
+		{
+			SetDirection(direction);
+		}
+	}
+
 	bool Enemy::IsPlayerInSameAxis(const std::shared_ptr<Player>& player, const bool verticalView) const
 	{
 		const auto playerHotspotPosition = player->Hotspot->GetPosition();
@@ -406,17 +465,24 @@ namespace mazer
 
 	bool Enemy::IsPlayerInLineOfSight(const gamelib::Direction lookDirection) const
 	{
-		const auto player = GameData::Get()->GetPlayer();
+		const auto player = world->Data().GetPlayer();
 
 		// Start search in the current room			
 		auto currentRoom = CurrentRoom->GetCurrentRoom();
+
+		// Rooms in the same straight corridor share its label, so there is no need to walk it
+		if (const auto& corridors = world->Data().GetCorridorSegments(); corridors.IsTracking(*currentRoom->GetGrid()))
+		{
+			return corridors.CanSee(CurrentRoom->RoomIndex, player->CurrentRoom->RoomIndex, lookDirection);
+		}
+
 		int nextRoomIndex;
 
 		// Look for line-on-sight in rooms in the direction specified
 		// Evaluate each room in that direction to see if its traversable until you reach the end of the map (-1)
 		while ((nextRoomIndex = currentRoom->GetNeighborIndex(gamelib::SideUtils::GetSideForDirection(lookDirection))) != -1)
 		{
-			const auto nextRoom = GameData::Get()->GetRoomByIndex(nextRoomIndex);
+			const auto nextRoom = world->Data().GetRoom(nextRoomIndex);
 			if (lookDirection == gamelib::Direction::Right)
 			{
 				if (currentRoom->HasRightWall() || nextRoom->HasLeftWall()) return false; // No line of sight
@@ -451,7 +517,7 @@ namespace mazer
 	}
 
 	// ReSharper disable CppPassValueParameterByConstReference
-	bool Enemy::InSameRoomAsPlayer(const std::shared_ptr<Player> player, const std::shared_ptr<Room> currentRoom)  // NOLINT
+	bool Enemy::InSameRoomAsPlayer(const std::shared_ptr<Player> player, const Room* currentRoom)  // NOLINT
 	{
 		return currentRoom->GetRoomNumber() == player->CurrentRoom->RoomIndex;
 	}
@@ -459,14 +525,19 @@ namespace mazer
 
 	void Enemy::CheckForPlayerCollision()
 	{
-		const auto player = GameDataManager::Get()->TheGameData()->GetPlayer();
+		const auto player = world->Data().GetPlayer();
 
-		if (InSameRoomAsPlayer(player, CurrentRoom->TheRoom) &&
+		if (InSameRoomAsPlayer(player, CurrentRoom->TheRoom.get()) &&
 			SdlCollisionDetection::IsColliding(&player->Bounds, &Bounds))
 		{
-			RaiseEvent(std::make_shared<PlayerCollidedWithEnemyEvent>(shared_from_this(), player));
-			RaiseEvent(GameObjectEventFactory::MakeRemoveObjectEvent(shared_from_this()));
+			CollideWithPlayer(player);
 		}
 	}
+
+	void Enemy::CollideWithPlayer(const std::shared_ptr<Player>& player)
+	{
+		world->Events().RaiseEvent(world->Pools().MakePlayerCollidedWithEnemyEvent(shared_from_this(), player), this);
+		world->Events().RaiseEvent(GameObjectEventFactory::MakeRemoveObjectEvent(shared_from_this()), this);
+	}
 }
 
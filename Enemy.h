@@ -12,6 +12,10 @@
 
 #include <cppgamelib/character/Npc.h>
 
+#include "MazerSettings.h"
+#include "SlotMap.h"
+#include "World.h"
+
 
 namespace gamelib
 {
@@ -24,12 +28,25 @@ namespace gamelib
 namespace mazer
 {
 
+	class EnemySystem;
 	class Level;
 	class Player;
 	class Room;
 
 	class RoomInfo;
 
+	// Where an enemy is and which way it faces, as copied in and out of an EnemySystem
+	struct EnemyPlacement
+	{
+		int X = 0;
+		int Y = 0;
+		int Width = 0;
+		int Height = 0;
+		int HotspotX = 0; // centre of the hotspot, relative to the position
+		int HotspotY = 0;
+		gamelib::Direction Direction = gamelib::Direction::None;
+	};
+
 	class Enemy final : public gamelib::Npc, public std::enable_shared_from_this<Enemy>
 	{
 	public:
@@ -39,13 +56,15 @@ namespace mazer
 			const std::shared_ptr<Room>& startRoom, std::shared_ptr<gamelib::AnimatedSprite> sprite,
 			gamelib::Direction startingDirection,
 			std::shared_ptr<const Level> level,
-			std::shared_ptr<gamelib::IGameObjectMoveStrategy> enemyMoveStrategy = nullptr);
+			std::shared_ptr<gamelib::IGameObjectMoveStrategy> enemyMoveStrategy = nullptr,
+			World& world = World::Default());
 
 
 		void Initialize();
 
 		std::shared_ptr<RoomInfo> CurrentRoom;
 		std::shared_ptr<const Level> CurrentLevel;
+		SlotHandle Handle; // in the game data, while registered
 		std::vector<std::shared_ptr<gamelib::Event>> HandleEvent(const std::shared_ptr<gamelib::Event>& event,
 			const unsigned long deltaMs) override;
 		void DoEnemyBehaviors(unsigned long deltaMs);
@@ -54,27 +73,40 @@ namespace mazer
 		void LoadSettings() override;
 		std::string GetSubscriberName() override { return Name; }
 		std::string GetName() override { return Name; }
+		[[nodiscard]] World& GetWorld() const { return *world; }
 
-	private:
+		// Whether the player is in a room further along the direction, with no wall in between
+		bool IsPlayerInLineOfSight(gamelib::Direction lookDirection) const;
+
+		// Raises the collision events if the enemy is touching the player
 		void CheckForPlayerCollision();
+
+		// Raises the collision events, for a player known to be touching the enemy
+		void CollideWithPlayer(const std::shared_ptr<Player>& player);
+
+		// While in an enemy system, the system moves the enemy and Update only animates it
+		[[nodiscard]] EnemySystem* GetEnemySystem() const { return enemySystem; }
+		void SetEnemySystem(EnemySystem* system) { enemySystem = system; }
+		[[nodiscard]] EnemyPlacement GetPlacement() const;
+		void SetPlacement(const EnemyPlacement& placement);
+
+	private:
+		World* world;
+		EnemySystem* enemySystem = nullptr;
 		bool isValidMove{};
 		bool IfMoved(gamelib::Direction direction) const;
+		void UpdateCurrentRoom() const;
 		bool IsPlayerInSameAxis(const std::shared_ptr<Player>& player, bool verticalView) const;
 		void LookForPlayer();
+		void ChasePlayer(); // along the flow field of the world
 		std::function<void(unsigned long deltaMs)> LookForPlayerAndMove();
-		bool IsPlayerInLineOfSight(gamelib::Direction lookDirection) const;
 		std::function<void(unsigned long deltaMs)> DoMovingBehavior();
-		static bool InSameRoomAsPlayer(std::shared_ptr<Player> player, std::shared_ptr<Room> currentRoom);
+		static bool InSameRoomAsPlayer(std::shared_ptr<Player> player, const Room* currentRoom);
 		void ConfigureEnemyBehavior();
 		std::function<bool()> IfMovedInDirection(gamelib::Direction direction) const; // returns a function returning a bool	
-		bool emitMoveEvents{};
-		bool moveAtSpeed{};
-		int speed{};
+		CurrentSettings settings;
 		gamelib::PeriodicTimer moveTimer;
-		int moveRateMs{};
-		bool animate = true;
-		bool drawState = false;
-		bool useBehaviorTree = false;
+		bool useBehaviorTree = false; // as when the behavior was configured
 
 		gamelib::BehaviorTree* behaviorTree = nullptr;
 		// NPCs have a state machine which they can configure statically
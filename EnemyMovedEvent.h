@@ -6,16 +6,25 @@
 
 namespace mazer
 {
+	class Enemy;
+
 	const gamelib::EventId EnemyMovedEventId(EnemyMoved, "EnemyMovedEvent");
 
 	class EnemyMovedEvent final : public gamelib::Event
 	{
 	public:
+		static constexpr int Number = EnemyMoved;
+
+		EnemyMovedEvent() : Event(EnemyMovedEventId) {}
+
 		explicit EnemyMovedEvent(std::shared_ptr<Enemy> enemy)
 			: Event(EnemyMovedEventId), TheEnemy(std::move(enemy))
 		{
 		}
 
+		// Lets go of the enemy once delivered, when pooled
+		void Clear() { TheEnemy.reset(); }
+
 		std::shared_ptr<Enemy> TheEnemy;
 	};
 }
@@ -0,0 +1,305 @@
+#include "EnemySystem.h"
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <utility>
+#include <cppgamelib/character/Hotspot.h>
+
+#include "BatchCollisionDetection.h"
+#include "Enemy.h"
+#include "GameData.h"
+#include "JobSystem.h"
+#include "MazeGrid.h"
+#include "MazerSettings.h"
+#include "Player.h"
+#include "PooledEvents.h"
+#include "Room.h"
+#include "RoomInfo.h"
+#include "World.h"
+
+using namespace gamelib;
+
+namespace mazer
+{
+	namespace
+	{
+		Direction GetOppositeDirection(const Direction direction)
+		{
+			switch (direction)
+			{
+			case Direction::Up: return Direction::Down;
+			case Direction::Down: return Direction::Up;
+			case Direction::Left: return Direction::Right;
+			case Direction::Right: return Direction::Left;
+			default: return Direction::None;
+			}
+		}
+
+		template <typename T>
+		void SwapRemove(std::vector<T>& values, const std::size_t index)
+		{
+			if (index + 1 != values.size()) { values[index] = std::move(values.back()); }
+			values.pop_back();
+		}
+	}
+
+	EnemySystem::EnemySystem(World& world) : world(world)
+	{
+		const auto settings = MazerSettings::Get();
+		pixelsPerMove = settings->Enemy.MoveAtSpeed ? settings->Enemy.Speed : 1;
+		moveRateMs = settings->Enemy.MoveRateMs > 0 ? static_cast<unsigned long>(settings->Enemy.MoveRateMs) : 0;
+		chaseByFlowField = settings->Enemy.ChaseByFlowField;
+		emitMoveEvents = settings->Enemy.EmitMoveEvents;
+	}
+
+	EnemySystem::~EnemySystem()
+	{
+		Clear();
+	}
+
+	void EnemySystem::Add(const std::shared_ptr<Enemy>& enemy)
+	{
+		// The enemies of a world are all in the one maze
+		if (grid == nullptr) { grid = enemy->CurrentRoom->TheRoom->GetGrid(); }
+
+		const auto placement = enemy->GetPlacement();
+		owners.push_back(enemy);
+		handles.push_back(enemy->Handle);
+		xs.push_back(placement.X);
+		ys.push_back(placement.Y);
+		widths.push_back(placement.Width);
+		heights.push_back(placement.Height);
+		hotspotXs.push_back(placement.HotspotX);
+		hotspotYs.push_back(placement.HotspotY);
+		directions.push_back(placement.Direction);
+		rooms.push_back(enemy->CurrentRoom->RoomIndex);
+		elapsedMs.push_back(0);
+		hitWalls.push_back(0);
+		events.push_back(0);
+
+		enemy->SetEnemySystem(this);
+	}
+
+	void EnemySystem::Clear()
+	{
+		for (const auto& enemy : owners) { enemy->SetEnemySystem(nullptr); }
+
+		owners.clear();
+		handles.clear();
+		xs.clear();
+		ys.clear();
+		widths.clear();
+		heights.clear();
+		hotspotXs.clear();
+		hotspotYs.clear();
+		directions.clear();
+		rooms.clear();
+		elapsedMs.clear();
+		hitWalls.clear();
+		events.clear();
+	}
+
+	void EnemySystem::Update(const unsigned long deltaMs, JobSystem* jobs)
+	{
+		const auto& gameData = world.Data();
+		if (gameData.IsGameWon() || owners.empty()) { return; }
+
+		// Killed enemies are removed from the game data when the events of the last tick were delivered. They are
+		// dropped first, in order, so that the pass works on the same arrays however it is split up
+		for (std::size_t i = 0; i < owners.size();)
+		{
+			if (gameData.GetEnemy(handles[i]) != owners[i].get()) { RemoveAt(i); }
+			else { i++; }
+		}
+
+		// Everything enemies look at is read once for the whole pass, and only read during it
+		Pass pass{ gameData.GetRoomLocator(), gameData.GetFlowField(), gameData.GetCorridorSegments() };
+		pass.DeltaMs = deltaMs;
+		pass.CanSee = !owners.empty() && pass.Corridors.IsTracking(*grid);
+		pass.ThePlayer = gameData.GetPlayer(gameData.GetPlayerHandle());
+		if (pass.ThePlayer != nullptr)
+		{
+			const auto hotspot = pass.ThePlayer->Hotspot->GetBounds();
+			pass.TheTarget.Room = pass.ThePlayer->CurrentRoom->RoomIndex;
+			pass.TheTarget.X = hotspot.x + hotspot.w / 2;
+			pass.TheTarget.Y = hotspot.y + hotspot.h / 2;
+			pass.TheTarget.HalfWidth = static_cast<int>(pass.ThePlayer->Hotspot->ParentWidth) / 2;
+			pass.TheTarget.HalfHeight = static_cast<int>(pass.ThePlayer->Hotspot->ParentHeight) / 2;
+		}
+
+		// Each enemy only writes its own entries, so ranges of enemies can be stepped on any thread
+		const auto step = [&](const std::size_t begin, const std::size_t end)
+			{
+				for (auto i = begin; i < end; i++) { Step(i, pass); }
+				if (pass.ThePlayer != nullptr) { FindTouching(begin, end, pass); }
+			};
+		if (jobs != nullptr) { jobs->ParallelFor(owners.size(), Grain, step); }
+		else { step(0, owners.size()); }
+
+		// Events are raised afterwards, one enemy at a time in index order, as a serial pass would raise them
+		for (std::size_t i = 0; i < owners.size(); i++)
+		{
+			const auto raiseMoved = emitMoveEvents && (events[i] & Moved) != 0;
+			const auto touching = (events[i] & Touching) != 0;
+			if (!raiseMoved && !touching) { continue; }
+
+			Sync(i);
+			if (raiseMoved)
+			{
+				world.Events().RaiseEvent(world.Pools().MakeEnemyMovedEvent(owners[i]), owners[i].get());
+			}
+			if (touching) { owners[i]->CheckForPlayerCollision(); }
+		}
+	}
+
+	void EnemySystem::Step(const std::size_t i, const Pass& pass)
+	{
+		const auto& target = pass.TheTarget;
+		auto moved = false;
+		elapsedMs[i] += pass.DeltaMs;
+
+		if (hitWalls[i] != 0)
+		{
+			// Turn back, every tick until a move succeeds
+			directions[i] = GetOppositeDirection(directions[i]);
+			moved = Move(i, pass.Locator);
+			hitWalls[i] = moved ? 0 : 1;
+		}
+		else
+		{
+			const auto seen = target.Room < 0 ? Direction::None
+				: chaseByFlowField ? pass.Flow.GetDirection(rooms[i])
+				: pass.CanSee ? Look(i, target, pass.Corridors)
+				: Direction::None;
+			if (seen != Direction::None) { directions[i] = seen; }
+
+			if (elapsedMs[i] >= moveRateMs)
+			{
+				moved = Move(i, pass.Locator);
+				hitWalls[i] = moved ? 0 : 1;
+				elapsedMs[i] = 0;
+			}
+		}
+
+		events[i] = static_cast<std::uint8_t>(moved && directions[i] != Direction::None ? Moved : 0);
+	}
+
+	void EnemySystem::FindTouching(const std::size_t begin, const std::size_t end, const Pass& pass)
+	{
+		// The player's bounds against the bounds of a block of enemies at a time, then only the hits are looked at
+		const BoundsColumns bounds{ xs.data(), ys.data(), widths.data(), heights.data() };
+		for (auto first = begin; first < end; first += BatchCollisionDetection::MaxBatch)
+		{
+			const auto count = std::min(end - first, BatchCollisionDetection::MaxBatch);
+			for (auto hits = BatchCollisionDetection::Overlaps(pass.ThePlayer->Bounds, bounds, first, count); hits != 0;
+				hits &= hits - 1)
+			{
+				const auto i = first + static_cast<std::size_t>(std::countr_zero(hits));
+				if (rooms[i] == pass.TheTarget.Room) { events[i] |= Touching; }
+			}
+		}
+	}
+
+	Direction EnemySystem::Look(const std::size_t index, const Target& target, const CorridorSegments& corridors) const
+	{
+		const auto room = rooms[index];
+		if (room == target.Room) { return Direction::None; }
+
+		// Like Enemy::LookForPlayer, only look along a row or column the player is lined up with
+		auto direction = Direction::None;
+		if (grid->GetColumn(room) == grid->GetColumn(target.Room) &&
+			std::abs(xs[index] + hotspotXs[index] - target.X) <= target.HalfWidth)
+		{
+			direction = target.Room < room ? Direction::Up : Direction::Down;
+		}
+		else if (grid->GetRow(room) == grid->GetRow(target.Room) &&
+			std::abs(ys[index] + hotspotYs[index] - target.Y) <= target.HalfHeight)
+		{
+			direction = target.Room < room ? Direction::Left : Direction::Right;
+		}
+
+		return direction != Direction::None && corridors.CanSee(room, target.Room, direction)
+			? direction
+			: Direction::None;
+	}
+
+	bool EnemySystem::Move(const std::size_t index, const RoomLocator& locator)
+	{
+		const auto room = rooms[index];
+		const auto direction = directions[index];
+
+		// As GameObjectMoveStrategy: an enemy touching a wall of its room cannot move through it
+		const auto left = locator.GetOriginX() + grid->GetColumn(room) * locator.GetSquareWidth();
+		const auto top = locator.GetOriginY() + grid->GetRow(room) * locator.GetSquareHeight();
+		const auto right = left + locator.GetSquareWidth();
+		const auto bottom = top + locator.GetSquareHeight();
+
+		auto& x = xs[index];
+		auto& y = ys[index];
+		switch (direction)
+		{
+		case Direction::Up:
+			if (grid->IsWalled(room, Side::Top) && y <= top) { return false; }
+			y -= pixelsPerMove;
+			break;
+		case Direction::Down:
+			if (grid->IsWalled(room, Side::Bottom) && y + heights[index] - 1 >= bottom) { return false; }
+			y += pixelsPerMove;
+			break;
+		case Direction::Left:
+			if (grid->IsWalled(room, Side::Left) && x <= left) { return false; }
+			x -= pixelsPerMove;
+			break;
+		case Direction::Right:
+			if (grid->IsWalled(room, Side::Right) && x + widths[index] - 1 >= right) { return false; }
+			x += pixelsPerMove;
+			break;
+		default:
+			return true; // moving in no direction is a valid move
+		}
+
+		// The room follows the hotspot
+		if (const auto next = locator.GetRoomIndex(x + hotspotXs[index], y + hotspotYs[index]); next >= 0)
+		{
+			rooms[index] = next;
+		}
+		return true;
+	}
+
+	void EnemySystem::Sync() const
+	{
+		for (std::size_t i = 0; i < owners.size(); i++) { Sync(i); }
+	}
+
+	void EnemySystem::Sync(const std::size_t index) const
+	{
+		EnemyPlacement placement;
+		placement.X = xs[index];
+		placement.Y = ys[index];
+		placement.Width = widths[index];
+		placement.Height = heights[index];
+		placement.HotspotX = hotspotXs[index];
+		placement.HotspotY = hotspotYs[index];
+		placement.Direction = directions[index];
+		owners[index]->SetPlacement(placement);
+	}
+
+	void EnemySystem::RemoveAt(const std::size_t index)
+	{
+		owners[index]->SetEnemySystem(nullptr);
+
+		SwapRemove(owners, index);
+		SwapRemove(handles, index);
+		SwapRemove(xs, index);
+		SwapRemove(ys, index);
+		SwapRemove(widths, index);
+		SwapRemove(heights, index);
+		SwapRemove(hotspotXs, index);
+		SwapRemove(hotspotYs, index);
+		SwapRemove(directions, index);
+		SwapRemove(rooms, index);
+		SwapRemove(elapsedMs, index);
+		SwapRemove(hitWalls, index);
+		SwapRemove(events, index);
+	}
+}
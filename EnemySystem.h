@@ -0,0 +1,131 @@
+#pragma once
+#ifndef ENEMYSYSTEM_H
+#define ENEMYSYSTEM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <cppgamelib/character/Direction.h>
+
+#include "SlotMap.h"
+
+namespace mazer
+{
+	class CorridorSegments;
+	class Enemy;
+	class FlowField;
+	class JobSystem;
+	class MazeGrid;
+	class Player;
+	class RoomLocator;
+	class World;
+
+	/**
+	 * \brief Moves every enemy of a world in one pass per tick, optionally spread over the threads of a JobSystem.
+	 *
+	 * The state the enemy state machine works on is kept here as parallel arrays: position, size, direction, room,
+	 * move timer and whether the last move hit a wall. Update walks them in a single loop, with no virtual calls or
+	 * std::function states per enemy. It behaves like the state machine of Enemy: look for the player,
+	 * move in the facing direction when the move timer is due, and turn back after hitting a wall.
+	 *
+	 * Enemies stay the objects the rest of the game sees. Sync copies positions back to them, e.g. before drawing.
+	 * Enemies that moved (when move events are on) or touch the player raise their events after the pass, in index
+	 * order, so the events do not depend on how the pass was split up. Enemies removed from the game data are
+	 * dropped on the next update.
+	 */
+	class EnemySystem
+	{
+	public:
+		explicit EnemySystem(World& world);
+		~EnemySystem();
+		EnemySystem(const EnemySystem&) = delete;
+		EnemySystem& operator=(const EnemySystem&) = delete;
+
+		// Takes over moving an enemy registered with the game data of the world
+		void Add(const std::shared_ptr<Enemy>& enemy);
+		void Clear();
+
+		// Steps the enemies on the jobs' threads, if given. The result is the same as without them
+		void Update(unsigned long deltaMs, JobSystem* jobs = nullptr);
+
+		// Copies positions and directions back to the enemies
+		void Sync() const;
+
+		[[nodiscard]] std::size_t size() const { return owners.size(); }
+		[[nodiscard]] bool empty() const { return owners.empty(); }
+
+		[[nodiscard]] const Enemy* GetEnemy(const std::size_t index) const { return owners[index].get(); }
+		[[nodiscard]] int GetX(const std::size_t index) const { return xs[index]; }
+		[[nodiscard]] int GetY(const std::size_t index) const { return ys[index]; }
+		[[nodiscard]] int GetRoom(const std::size_t index) const { return rooms[index]; }
+		[[nodiscard]] gamelib::Direction GetDirection(const std::size_t index) const { return directions[index]; }
+
+	private:
+		// What the player looks like to enemies on this tick
+		struct Target
+		{
+			int Room = -1;
+			int X = 0; // hotspot centre
+			int Y = 0;
+			int HalfWidth = 0;
+			int HalfHeight = 0;
+		};
+
+		// What an enemy did on this tick, for the events raised after the pass
+		enum StepEvent : std::uint8_t { Moved = 1, Touching = 2 };
+
+		// Enemies per job: enough that a job is worth handing to another thread
+		static constexpr std::size_t Grain = 256;
+
+		// What every enemy reads during one update
+		struct Pass
+		{
+			const RoomLocator& Locator;
+			const FlowField& Flow;
+			const CorridorSegments& Corridors;
+			unsigned long DeltaMs = 0;
+			bool CanSee = false;
+			const Player* ThePlayer = nullptr;
+			Target TheTarget;
+		};
+
+		void Step(std::size_t index, const Pass& pass);
+
+		// Marks the enemies of a range that are in the player's room and touching the player
+		void FindTouching(std::size_t begin, std::size_t end, const Pass& pass);
+
+		// The way to the player if the enemy can see it along a corridor, or None
+		[[nodiscard]] gamelib::Direction Look(std::size_t index, const Target& target,
+			const CorridorSegments& corridors) const;
+
+		// Moves one step in the facing direction, false if a wall is in the way
+		bool Move(std::size_t index, const RoomLocator& locator);
+		void Sync(std::size_t index) const;
+		void RemoveAt(std::size_t index);
+
+		World& world;
+		std::shared_ptr<const MazeGrid> grid;
+		int pixelsPerMove;
+		unsigned long moveRateMs;
+		bool chaseByFlowField;
+		bool emitMoveEvents;
+
+		// One entry per enemy, at the same index in each array
+		std::vector<std::shared_ptr<Enemy>> owners;
+		std::vector<SlotHandle> handles;
+		std::vector<int> xs;
+		std::vector<int> ys;
+		std::vector<int> widths;
+		std::vector<int> heights;
+		std::vector<int> hotspotXs;
+		std::vector<int> hotspotYs;
+		std::vector<gamelib::Direction> directions;
+		std::vector<int> rooms;
+		std::vector<unsigned long> elapsedMs;
+		std::vector<std::uint8_t> hitWalls;
+		std::vector<std::uint8_t> events; // of the last update
+	};
+}
+
+#endif
@@ -1,4 +1,6 @@
 #pragma once
+#include <memory>
+#include <cppgamelib/events/Event.h>
 #include <cppgamelib/events/EventId.h>
 
 namespace mazer
@@ -23,4 +25,12 @@ namespace mazer
 	const static gamelib::EventId PlayerDiedEventId(PLayerDied, "PLayerDied");
 	const static gamelib::EventId SettingsReloadedEventId(SettingsReloaded, "SettingsReloaded");
 	const static gamelib::EventId InvalidMoveEventId(InvalidMove, "InvalidMove");
+
+	// The event as the mazer event type that its number says it is, or null if it is another event. A static cast
+	// rather than a dynamic one, as each number has one event type with a matching Number
+	template <typename TEvent>
+	TEvent* EventAs(const std::shared_ptr<gamelib::Event>& event)
+	{
+		return event != nullptr && event->Id.PrimaryId == TEvent::Number ? static_cast<TEvent*>(event.get()) : nullptr;
+	}
 }
\ No newline at end of file
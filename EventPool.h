@@ -0,0 +1,127 @@
+#pragma once
+#ifndef EVENTPOOL_H
+#define EVENTPOOL_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace mazer
+{
+	/**
+	 * \brief Hands out events to raise, reusing events that have been delivered instead of allocating new ones.
+	 *
+	 * The event manager lets go of an event once it has been delivered. When the last holder lets go, the event goes
+	 * back to the pool and, for types that have a Clear, is cleared so the pool does not keep alive what it points to,
+	 * e.g. an enemy that moved and has since been removed. The control blocks of the handed out pointers are reused
+	 * too, so when the pool holds as many events as are in flight at once, raising an event allocates nothing.
+	 * Not thread safe, as events are raised on the game thread.
+	 */
+	template <typename TEvent>
+	class EventPool
+	{
+	public:
+		using Factory = std::function<std::shared_ptr<TEvent>()>;
+
+		// New events come from the factory, or are default constructed
+		explicit EventPool(Factory factory = [] { return std::make_shared<TEvent>(); })
+			: state(std::make_shared<State>(std::move(factory)))
+		{
+		}
+
+		// An event that nobody holds, or a new one if every pooled event is in flight
+		std::shared_ptr<TEvent> Acquire()
+		{
+			if (state->free.empty())
+			{
+				state->events.push_back(state->factory());
+				state->free.reserve(state->events.capacity());
+				state->blocks.reserve(state->events.capacity());
+				state->free.push_back(state->events.size() - 1);
+			}
+
+			const auto slot = state->free.back();
+			state->free.pop_back();
+			return std::shared_ptr<TEvent>(state->events[slot].get(), Release{ state.get(), slot },
+				BlockAllocator<TEvent>(state));
+		}
+
+		[[nodiscard]] std::size_t size() const { return state->events.size(); }
+
+	private:
+		// Outlives the pool while any event it handed out is still held
+		struct State
+		{
+			explicit State(Factory factory) : factory(std::move(factory)) {}
+			State(const State&) = delete;
+			State& operator=(const State&) = delete;
+
+			~State()
+			{
+				for (auto* block : blocks) { ::operator delete(block); }
+			}
+
+			Factory factory;
+			std::vector<std::shared_ptr<TEvent>> events;
+			std::vector<std::size_t> free; // events nobody holds
+			std::vector<void*> blocks; // control blocks of events that went back to the pool
+		};
+
+		// Puts an event back in the pool once its last holder lets go
+		struct Release
+		{
+			State* state;
+			std::size_t slot;
+
+			void operator()(TEvent* event) const
+			{
+				if constexpr (requires(TEvent& pooled) { pooled.Clear(); }) { event->Clear(); }
+				state->free.push_back(slot);
+			}
+		};
+
+		// Reuses the control blocks of events that went back to the pool. It keeps the state alive because the control
+		// block is freed after the deleter has run
+		template <typename T>
+		struct BlockAllocator
+		{
+			using value_type = T;
+
+			explicit BlockAllocator(std::shared_ptr<State> state) : state(std::move(state)) {}
+
+			template <typename U>
+			BlockAllocator(const BlockAllocator<U>& other) : state(other.state) {}
+
+			T* allocate(const std::size_t count)
+			{
+				// Every control block of a pool is the same type, so any cached block fits
+				if (count == 1 && !state->blocks.empty())
+				{
+					auto* block = state->blocks.back();
+					state->blocks.pop_back();
+					return static_cast<T*>(block);
+				}
+
+				return static_cast<T*>(::operator new(count * sizeof(T)));
+			}
+
+			void deallocate(T* block, const std::size_t count)
+			{
+				if (count == 1) { state->blocks.push_back(block); }
+				else { ::operator delete(block); }
+			}
+
+			template <typename U>
+			bool operator==(const BlockAllocator<U>& other) const { return state == other.state; }
+
+			std::shared_ptr<State> state;
+		};
+
+		std::shared_ptr<State> state;
+	};
+}
+
+#endif
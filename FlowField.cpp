@@ -0,0 +1,130 @@
+#include "FlowField.h"
+
+#include "MazeGrid.h"
+
+using namespace gamelib;
+
+namespace mazer
+{
+	namespace
+	{
+		constexpr Side Sides[] = { Side::Top, Side::Right, Side::Bottom, Side::Left };
+
+		// The way out of a room through the given side
+		Direction ToDirection(const Side side)
+		{
+			switch (side)
+			{
+			case Side::Top: return Direction::Up;
+			case Side::Right: return Direction::Right;
+			case Side::Bottom: return Direction::Down;
+			case Side::Left: return Direction::Left;
+			default: return Direction::None;
+			}
+		}
+
+		// The way back through the given side, from the neighbour on that side
+		Direction ToOppositeDirection(const Side side)
+		{
+			switch (side)
+			{
+			case Side::Top: return Direction::Down;
+			case Side::Right: return Direction::Left;
+			case Side::Bottom: return Direction::Up;
+			case Side::Left: return Direction::Right;
+			default: return Direction::None;
+			}
+		}
+	}
+
+	void FlowField::SetTarget(const std::shared_ptr<const MazeGrid>& grid, const int target)
+	{
+		if (grid == this->grid && target == this->target) { return; }
+
+		this->grid = grid;
+		this->target = target;
+		Rebuild();
+	}
+
+	void FlowField::Rebuild()
+	{
+		distances.clear();
+		directions.clear();
+		frontier.clear();
+
+		if (grid == nullptr) { return; }
+
+		distances.assign(grid->GetRoomCount(), Unreachable);
+		directions.assign(grid->GetRoomCount(), Direction::None);
+		rebuilds++;
+
+		if (!grid->IsValidIndex(target)) { return; }
+
+		distances[target] = 0;
+		frontier.push_back(target);
+		Spread();
+	}
+
+	void FlowField::OnWallRemoved(const MazeGrid& changed, const int index, const Side side)
+	{
+		if (!IsTracking(changed) || !changed.IsValidIndex(index)) { return; }
+
+		const auto neighbor = changed.GetNeighborIndex(index, side);
+		if (neighbor < 0) { return; }
+
+		// Opening a wall can only bring rooms closer, and only through the rooms either side of it
+		const auto here = distances[index];
+		const auto there = distances[neighbor];
+		if (here == Unreachable && there == Unreachable) { return; }
+
+		const auto nearIsHere = there == Unreachable || (here != Unreachable && here < there);
+		const auto near = nearIsHere ? index : neighbor;
+		const auto far = nearIsHere ? neighbor : index;
+		if (distances[far] != Unreachable && distances[far] <= distances[near] + 1) { return; }
+
+		distances[far] = distances[near] + 1;
+		directions[far] = nearIsHere ? ToOppositeDirection(side) : ToDirection(side);
+
+		frontier.clear();
+		frontier.push_back(far);
+		Spread();
+	}
+
+	void FlowField::OnWallAdded(const MazeGrid& changed)
+	{
+		// Closing a wall can push rooms anywhere further away, so search again
+		if (IsTracking(changed)) { Rebuild(); }
+	}
+
+	void FlowField::Clear()
+	{
+		grid.reset();
+		target = -1;
+		distances.clear();
+		directions.clear();
+		frontier.clear();
+	}
+
+	void FlowField::Spread()
+	{
+		// Breadth first from one source, so each room is reached first by a shortest path through it
+		for (std::size_t head = 0; head < frontier.size(); head++)
+		{
+			const auto room = frontier[head];
+			const auto next = distances[room] + 1;
+
+			for (const auto side : Sides)
+			{
+				if (grid->IsWalled(room, side)) { continue; }
+
+				const auto neighbor = grid->GetNeighborIndex(room, side);
+				if (neighbor < 0) { continue; }
+				if (distances[neighbor] != Unreachable && distances[neighbor] <= next) { continue; }
+
+				distances[neighbor] = next;
+				directions[neighbor] = ToOppositeDirection(side);
+				frontier.push_back(neighbor);
+			}
+		}
+	}
+}
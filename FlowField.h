@@ -0,0 +1,70 @@
+#pragma once
+#ifndef FLOWFIELD_H
+#define FLOWFIELD_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <cppgamelib/character/Direction.h>
+#include <cppgamelib/geometry/Side.h>
+
+namespace mazer
+{
+	class MazeGrid;
+
+	/**
+	 * \brief Distance and direction from every room of a maze to one target room, e.g. the player's.
+	 *
+	 * Built by a breadth-first search over the open walls of a MazeGrid and kept current incrementally: moving the
+	 * target rebuilds the field, removing a wall only revisits the rooms that get closer through the new opening.
+	 * Reading which way to go from a room is then one array read, however many enemies ask.
+	 */
+	class FlowField
+	{
+	public:
+		static constexpr int Unreachable = -1;
+
+		// Points the field at a room of the grid, rebuilding only if the grid or the room changed
+		void SetTarget(const std::shared_ptr<const MazeGrid>& grid, int target);
+
+		// Searches again from the target, after changes the field was not told about
+		void Rebuild();
+
+		// The wall on the given side of a room has been removed or added. Ignored unless it is the grid of the field
+		void OnWallRemoved(const MazeGrid& changed, int index, gamelib::Side side);
+		void OnWallAdded(const MazeGrid& changed);
+
+		void Clear();
+
+		[[nodiscard]] bool IsTracking(const MazeGrid& other) const { return grid.get() == &other; }
+		[[nodiscard]] int GetTarget() const { return target; }
+
+		// Rooms between a room and the target, or Unreachable
+		[[nodiscard]] int GetDistance(const int index) const
+		{
+			return static_cast<std::size_t>(index) < distances.size() ? distances[index] : Unreachable;
+		}
+
+		// Which way to leave a room to get closer to the target: None in the target room and unreachable rooms
+		[[nodiscard]] gamelib::Direction GetDirection(const int index) const
+		{
+			return static_cast<std::size_t>(index) < directions.size() ? directions[index] : gamelib::Direction::None;
+		}
+
+		// Number of full searches so far, incremental updates excluded
+		[[nodiscard]] int GetRebuildCount() const { return rebuilds; }
+
+	private:
+		// Visits the rooms in the frontier in order, lowering the distances of their open neighbours
+		void Spread();
+
+		std::shared_ptr<const MazeGrid> grid;
+		int target = -1;
+		int rebuilds = 0;
+		std::vector<int> distances;
+		std::vector<gamelib::Direction> directions;
+		std::vector<int> frontier; // reused between searches
+	};
+}
+
+#endif
@@ -6,19 +6,51 @@
 #include "pickup.h"
 #include "Player.h"
 #include "Enemy.h"
+#include "MazeGrid.h"
+#include "RoomInfo.h"
 
 using namespace gamelib;
 using namespace std;
 
 namespace mazer
 {
+	namespace
+	{
+		// Issues the object a handle, returns false if it already has one in the map
+		template <typename T>
+		bool Register(SlotMap<T>& map, const std::shared_ptr<T>& object)
+		{
+			if (map.Get(object->Handle) == object.get()) { return false; }
+			object->Handle = map.Insert(object);
+			return true;
+		}
+
+		template <typename T>
+		void Unregister(SlotMap<T>& map, const std::shared_ptr<T>& object)
+		{
+			if (map.Get(object->Handle) != object.get()) { return; }
+			map.Remove(object->Handle);
+			object->Handle = {};
+		}
+	}
+
 	GameData::GameData() : isGameWon(false) {}
 
 	void GameData::Clear()
 	{
 		enemies.clear();
 		pickups.clear();
+		enemiesByRoom.Clear();
+		pickupsByRoom.Clear();
 		rooms.clear();
+		roomSlots.clear();
+		roomCount = 0;
+		roomLocator = {};
+		flowField.Clear();
+		corridorSegments.Clear();
+		players.clear();
+		playerHandle = {};
+		player.reset();
 		GameObjects.clear();
 		isGameWon = false;
 		IsNetworkGame = false;
@@ -28,71 +60,92 @@ namespace mazer
 
 	void GameData::AddRoom(const std::shared_ptr<Room>& room)
 	{
-		rooms[room->GetRoomNumber()] = room;
+		const auto roomNumber = room->GetRoomNumber();
+		if (roomNumber < 0) { return; }
+
+		if (roomNumber >= static_cast<int>(rooms.size())) { rooms.resize(static_cast<std::size_t>(roomNumber) + 1); }
+		if (rooms[roomNumber] == nullptr) { roomCount++; }
+		else if (rooms[roomNumber] != room) { Unregister(roomSlots, rooms[roomNumber]); }
+		rooms[roomNumber] = room;
+		Register(roomSlots, room);
 		AddGameObject(room);
+
+		// The rooms of a level are the cells of one grid, so any room describes the layout of all of them
+		const auto& grid = room->GetGrid();
+		if (grid != nullptr && grid->IsValidIndex(room->GetRoomNumber()))
+		{
+			const auto row = grid->GetRow(room->GetRoomNumber());
+			const auto column = grid->GetColumn(room->GetRoomNumber());
+			roomLocator = RoomLocator(grid->GetRows(), grid->GetColumns(), room->GetWidth(), room->GetHeight(),
+				room->GetX() - column * room->GetWidth(), room->GetY() - row * room->GetHeight());
+
+			if (!corridorSegments.IsTracking(*grid)) { corridorSegments.Build(grid); }
+		}
 	}
 
 	void GameData::RemoveRoom(const std::shared_ptr<Room>& room)
 	{
-		rooms.erase(room->GetRoomNumber());
+		const auto roomNumber = room->GetRoomNumber();
+		if (GetRoom(roomNumber) == room.get())
+		{
+			rooms[roomNumber] = nullptr;
+			roomCount--;
+		}
+		Unregister(roomSlots, room);
 		RemoveGameObject(room);
 	}
 
 	void GameData::RemovePickup(const std::shared_ptr<Pickup>& pickup)
 	{
-		pickups.erase(remove_if(begin(pickups), end(pickups), [=](const weak_ptr<GameObject>& obj)
-			{
-				return IsSameId(obj, pickup);
-			}), pickups.end());
-
+		if (pickups.Get(pickup->Handle) == pickup.get()) { pickupsByRoom.Remove(pickup->RoomNumber, pickup->Handle); }
+		Unregister(pickups, pickup);
 		RemoveGameObject(pickup);
 	}
 
 	void GameData::RemoveGameObject(const std::shared_ptr<GameObject>& gameObject)
 	{
-		GameObjects.erase(remove_if(begin(GameObjects), end(GameObjects), [=](const weak_ptr<GameObject>& obj)
-			{
-				return IsSameId(obj, gameObject);
-			}), GameObjects.end());
+		GameObjects.Remove(gameObject->Id);
 	}
 
 	void GameData::RemoveExpiredReferences()
 	{
-		GameObjects.erase(remove_if(begin(GameObjects), end(GameObjects),
-			[&](const weak_ptr<GameObject>& obj) { return obj.expired(); }), end(GameObjects));
+		GameObjects.RemoveExpired();
+		pickups.RemoveExpired();
+		enemies.RemoveExpired();
+		players.RemoveExpired();
+
+		pickupsByRoom.RemoveIf([this](const SlotHandle handle) { return pickups.Get(handle) == nullptr; });
+		enemiesByRoom.RemoveIf([this](const SlotHandle handle) { return enemies.Get(handle) == nullptr; });
 	}
 
 
 	void GameData::AddEnemy(const std::shared_ptr<Enemy> enemy)
 	{
-		if (std::find_if(enemies.begin(), enemies.end(), [&](const std::weak_ptr<GameObject>& gameObject)
-			{
-				return !gameObject.expired() && gameObject.lock()->Id == enemy->Id;
-			}) == enemies.end())
+		if (Register(enemies, enemy))
 		{
-			enemies.push_back(enemy);
+			if (enemy->CurrentRoom != nullptr) { enemiesByRoom.Add(enemy->CurrentRoom->RoomIndex, enemy->Handle); }
 			AddGameObject(enemy);
 		}
 	}
 
 	void GameData::RemoveEnemy(const std::shared_ptr<Enemy>& enemy)
 	{
-		enemies.erase(remove_if(begin(enemies), end(enemies), [=](const weak_ptr<GameObject>& obj)
-			{
-				return IsSameId(obj, enemy);
-			}), enemies.end());
-
+		if (enemies.Get(enemy->Handle) == enemy.get() && enemy->CurrentRoom != nullptr)
+		{
+			enemiesByRoom.Remove(enemy->CurrentRoom->RoomIndex, enemy->Handle);
+		}
+		Unregister(enemies, enemy);
 		RemoveGameObject(enemy);
 	}
 
-	bool GameData::IsSameId(const weak_ptr<GameObject>& obj, const std::shared_ptr<GameObject>& other)
+	std::shared_ptr<Room> GameData::GetRoomByIndex(const int roomNumber) const
 	{
-		return !obj.expired() && obj.lock()->Id == other->Id;
+		return roomNumber >= 0 && roomNumber < static_cast<int>(rooms.size()) ? rooms[roomNumber] : nullptr;
 	}
 
-	std::shared_ptr<Room> GameData::GetRoomByIndex(const int roomNumber)
+	Room* GameData::GetRoomAt(const int x, const int y) const
 	{
-		return rooms[roomNumber].lock();
+		return GetRoom(roomLocator.GetRoomIndex(x, y));
 	}
 
 	std::shared_ptr<Player> GameData::GetPlayer() const
@@ -100,6 +153,37 @@ namespace mazer
 		return dynamic_pointer_cast<Player>(player.lock());
 	}
 
+	void GameData::SetPlayer(const std::shared_ptr<Player>& newPlayer)
+	{
+		if (const auto current = players.Lock(playerHandle); current != nullptr && current != newPlayer)
+		{
+			Unregister(players, current);
+		}
+		Register(players, newPlayer);
+		playerHandle = newPlayer->Handle;
+		player = newPlayer;
+
+		if (newPlayer->CurrentRoom != nullptr && newPlayer->CurrentRoom->TheRoom != nullptr)
+		{
+			const auto& room = newPlayer->CurrentRoom->TheRoom;
+			flowField.SetTarget(room->GetGrid(), room->GetRoomNumber());
+		}
+	}
+
+	void GameData::OnEnemyChangedRoom(const Enemy& enemy, const int from)
+	{
+		if (enemies.Get(enemy.Handle) != &enemy) { return; }
+		enemiesByRoom.Move(enemy.Handle, from, enemy.CurrentRoom->RoomIndex);
+	}
+
+	void GameData::OnWallChanged(const MazeGrid& grid, const int index, const Side side)
+	{
+		corridorSegments.OnWallChanged(grid, index, side);
+
+		if (grid.IsWalled(index, side)) { flowField.OnWallAdded(grid); }
+		else { flowField.OnWallRemoved(grid, index, side); }
+	}
+
 	GameData* GameData::Get()
 	{
 		if (instance == nullptr) { instance = new GameData(); }
@@ -108,25 +192,13 @@ namespace mazer
 
 	void GameData::AddPickup(const std::shared_ptr<Pickup> pickup)
 	{
-		if (std::find_if(pickups.begin(), pickups.end(), [&](const std::weak_ptr<GameObject>& gameObject)
-			{
-				return !gameObject.expired() && gameObject.lock()->Id == pickup->Id;
-			}) == pickups.end())
-		{
-			pickups.push_back(pickup);
-		}
+		if (Register(pickups, pickup)) { pickupsByRoom.Add(pickup->RoomNumber, pickup->Handle); }
 		AddGameObject(pickup);
 		if (!pickups.empty()) { SetGameWon(false); }
 	}
 
 	void GameData::AddGameObject(const std::shared_ptr<GameObject>& gameObject)
 	{
-		if (std::find_if(GameObjects.begin(), GameObjects.end(), [=](const weak_ptr<GameObject>& obj)
-			{
-				return IsSameId(obj, gameObject);
-			}) == GameObjects.end())
-		{
-			GameObjects.push_back(gameObject);
-		}
+		GameObjects.Add(gameObject->Id, gameObject);
 	}
 }
@@ -7,6 +7,13 @@
 #include <vector>
 #include <objects/GameWorldData.h>
 
+#include "CorridorSegments.h"
+#include "FlowField.h"
+#include "GameObjectRegistry.h"
+#include "RoomBuckets.h"
+#include "RoomLocator.h"
+#include "SlotMap.h"
+
 namespace gamelib
 {
 	class GameObject;
@@ -19,21 +26,27 @@ namespace mazer
 	class Player;
 	class Pickup;
 	class Enemy;
+	class MazeGrid;
 
 
 	/**
 	 * \brief Holds Game Data that is updated periodically by the Game Data Manager
+	 *
+	 * Each World has its own game data; Get() is the game data of the default world.
 	 */
 	class GameData : public gamelib::GameWorldData
 	{
 	public:
+		GameData();
 		static GameData* Get();
 		GameData(const GameData&) = delete;
 		GameData(const GameData&&) = delete;
 		GameData& operator=(const GameData&) = delete;
 		GameData& operator=(const GameData&&) = delete;
-		~GameData() { instance = nullptr; }
+		~GameData() { if (instance == this) { instance = nullptr; } }
 
+		// Rooms are kept in one block indexed by room number. The game data shares ownership of the rooms of the
+		// level until they are removed or the game data is cleared
 		void AddRoom(const std::shared_ptr<Room>& room);
 		void RemoveRoom(const std::shared_ptr<Room>& room);
 		void AddPickup(std::shared_ptr<Pickup> pickup);
@@ -41,9 +54,29 @@ namespace mazer
 		void AddEnemy(std::shared_ptr<Enemy> enemy);
 		void RemoveEnemy(const std::shared_ptr<Enemy>& enemy);
 
-		std::shared_ptr<Room> GetRoomByIndex(int roomNumber);
+		[[nodiscard]] std::shared_ptr<Room> GetRoomByIndex(int roomNumber) const;
+
+		// Fast access for the simulation: an array index with no reference counting. Valid while the room is registered
+		[[nodiscard]] Room* GetRoom(const int roomNumber) const
+		{
+			return roomNumber >= 0 && roomNumber < static_cast<int>(rooms.size()) ? rooms[roomNumber].get() : nullptr;
+		}
+
+		[[nodiscard]] int CountRooms() const { return roomCount; }
+
+		// Handle lookups: null once the object has been removed, even if its slot has been reused since
+		[[nodiscard]] Room* GetRoom(const SlotHandle handle) const { return roomSlots.Get(handle); }
+		[[nodiscard]] Pickup* GetPickup(const SlotHandle handle) const { return pickups.Get(handle); }
+		[[nodiscard]] Enemy* GetEnemy(const SlotHandle handle) const { return enemies.Get(handle); }
+		[[nodiscard]] Player* GetPlayer(const SlotHandle handle) const { return players.Get(handle); }
+
+		// Finds the room at a position, from the layout of the rooms added so far
+		[[nodiscard]] const RoomLocator& GetRoomLocator() const { return roomLocator; }
+		[[nodiscard]] Room* GetRoomAt(int x, int y) const;
 		[[nodiscard]]
 		std::shared_ptr<Player> GetPlayer() const;
+		[[nodiscard]] SlotHandle GetPlayerHandle() const { return playerHandle; }
+		void SetPlayer(const std::shared_ptr<Player>& newPlayer);
 		[[nodiscard]]
 		unsigned int CountPickups() const { return static_cast<unsigned int>(pickups.size()); }
 		[[nodiscard]]
@@ -54,20 +87,47 @@ namespace mazer
 		void RemoveExpiredReferences();
 		void Clear();
 
-		std::vector<std::weak_ptr<gamelib::GameObject>> GameObjects;
-		std::vector<std::weak_ptr<Enemy>> Enemies() { return enemies; }
+		// Game objects by id. Iterates like the vector it replaced, but adding and removing are constant time
+		GameObjectRegistry<gamelib::GameObject> GameObjects;
+
+		// All enemies and pickups, contiguous. Iterating allocates nothing and takes no references
+		[[nodiscard]] const SlotMap<Enemy>& Enemies() const { return enemies; }
+		[[nodiscard]] const SlotMap<Pickup>& Pickups() const { return pickups; }
+
+		// Handles of the pickups and enemies in a room, for finding what the player touches without asking everything
+		[[nodiscard]] const std::vector<SlotHandle>& GetPickupsInRoom(const int room) const { return pickupsByRoom.Get(room); }
+		[[nodiscard]] const std::vector<SlotHandle>& GetEnemiesInRoom(const int room) const { return enemiesByRoom.Get(room); }
+
+		// Moves a registered enemy to the bucket of the room it is in now
+		void OnEnemyChangedRoom(const Enemy& enemy, int from);
+
+		// Which way to the player from each room. Follows the player between rooms and walls being removed
+		[[nodiscard]] const FlowField& GetFlowField() const { return flowField; }
+		[[nodiscard]] FlowField& GetFlowField() { return flowField; }
+
+		// The straight corridors of the maze of the rooms, for line of sight checks
+		[[nodiscard]] const CorridorSegments& GetCorridorSegments() const { return corridorSegments; }
+
+		// Keeps what is derived from the walls of the maze up to date after a wall of a room is added or removed
+		void OnWallChanged(const MazeGrid& grid, int index, gamelib::Side side);
 
 	protected:
-		GameData();
 		static GameData* instance;
 
 	private:
-		static bool IsSameId(const std::weak_ptr<gamelib::GameObject>& obj,
-			const std::shared_ptr<gamelib::GameObject>& other);
 		bool isGameWon;
-		std::map<int, std::weak_ptr<Room>> rooms;
-		std::vector<std::weak_ptr<Pickup>> pickups;
-		std::vector<std::weak_ptr<Enemy>> enemies;
+		std::vector<std::shared_ptr<Room>> rooms; // by room number, empty slots are null
+		int roomCount = 0;
+		SlotMap<Room> roomSlots;
+		RoomLocator roomLocator;
+		SlotMap<Pickup> pickups;
+		SlotMap<Enemy> enemies;
+		RoomBuckets pickupsByRoom;
+		RoomBuckets enemiesByRoom;
+		SlotMap<Player> players;
+		SlotHandle playerHandle;
+		FlowField flowField;
+		CorridorSegments corridorSegments;
 	};
 }
 
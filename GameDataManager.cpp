@@ -11,6 +11,7 @@
 #include <cppgamelib/events/EventManager.h>
 #include <cppgamelib/events/EventFactory.h>
 #include "Enemy.h"
+#include "MazerSettings.h"
 
 using namespace std;
 using namespace gamelib;
@@ -21,18 +22,22 @@ namespace mazer
 	{
 		SubscribeToEvent(AddGameObjectToCurrentSceneEventId);
 		SubscribeToEvent(GameObjectTypeEventId);
-		GameData::Get()->IsNetworkGame = isNetworkGame;
-		GameData::Get()->IsGameDone = false;
-		GameData::Get()->IsNetworkGame = false;
-		GameData::Get()->CanDraw = true;
-		GameWorldData.CanDraw = GameData::Get()->CanDraw;
-		GameWorldData.IsNetworkGame = GameData::Get()->IsNetworkGame;
-		GameWorldData.IsGameDone = GameData::Get()->IsGameDone;
+		SubscribeToEvent(SettingsReloadedEventId);
+		const auto gameData = TheGameData();
+		gameData->IsNetworkGame = isNetworkGame;
+		gameData->IsGameDone = false;
+		gameData->IsNetworkGame = false;
+		gameData->CanDraw = true;
+		GameWorldData.CanDraw = gameData->CanDraw;
+		GameWorldData.IsNetworkGame = gameData->IsNetworkGame;
+		GameWorldData.IsGameDone = gameData->IsGameDone;
 	}
 
-	GameDataManager::GameDataManager()
+	GameDataManager::GameDataManager() : GameDataManager(nullptr, nullptr) {}
+
+	GameDataManager::GameDataManager(GameData* gameData, EventManager* eventManager)
+		: gameData(gameData), eventManager(eventManager != nullptr ? eventManager : EventManager::Get())
 	{
-		eventManager = EventManager::Get();
 		eventFactory = EventFactory::Get();
 	}
 
@@ -44,7 +49,7 @@ namespace mazer
 
 	GameDataManager::~GameDataManager()
 	{
-		instance = nullptr;
+		if (instance == this) { instance = nullptr; }
 	}
 
 	ListOfEvents GameDataManager::HandleEvent(const std::shared_ptr<Event>& event, const unsigned long deltaMs)
@@ -58,6 +63,11 @@ namespace mazer
 		{
 			RemoveFromGameData(To<GameObjectEvent>(event));
 		}
+
+		if (event->Id.PrimaryId == SettingsReloadedEventId.PrimaryId)
+		{
+			ReloadSettings();
+		}
 		return {};
 	}
 
@@ -99,9 +109,9 @@ namespace mazer
 			RemoveGameObject(event->Object);
 		}
 
-		if (GameData::Get()->CountPickups() == 0 && !GameData::Get()->IsGameWon())
+		if (TheGameData()->CountPickups() == 0 && !TheGameData()->IsGameWon())
 		{
-			GameData::Get()->SetGameWon(true);
+			TheGameData()->SetGameWon(true);
 			eventManager->RaiseEvent(EventFactory::Get()->CreateGenericEvent(GameWonEventId, GetSubscriberName()), this);
 		}
 	}
@@ -110,23 +120,29 @@ namespace mazer
 	{
 		if (gameObject->Type == "Room")
 		{
-			GameData::Get()->RemoveRoom(To<Room>(gameObject));
+			TheGameData()->RemoveRoom(To<Room>(gameObject));
 		}
 
 		if (gameObject->Type == "Pickup")
 		{
-			GameData::Get()->RemovePickup(To<Pickup>(gameObject));
+			TheGameData()->RemovePickup(To<Pickup>(gameObject));
 		}
 
 		if (gameObject->Type == "Enemy")
 		{
-			GameData::Get()->RemoveEnemy(To<Enemy>(gameObject));
+			TheGameData()->RemoveEnemy(To<Enemy>(gameObject));
 		}
 
-		GameData::Get()->RemoveGameObject(gameObject);
-		GameData::Get()->RemoveExpiredReferences();
+		// Removal is by id, so there is no need to sweep every object for expired references here
+		TheGameData()->RemoveGameObject(gameObject);
 		eventManager->Unsubscribe(gameObject->GetSubscriberId());
 	}
 
+	void GameDataManager::ReloadSettings() const
+	{
+		// One new snapshot for everyone. Objects read it where they use a setting, so none of them is told
+		MazerSettings::Reload();
+	}
+
 	GameDataManager* GameDataManager::instance = nullptr;
 }
@@ -22,6 +22,11 @@ namespace mazer
 	class GameDataManager final : public gamelib::EventSubscriber
 	{
 	public:
+		// Manages the game data of one world, raising events on the given event manager or the shared one if null.
+		// Null game data is the default world's
+		GameDataManager(GameData* gameData, gamelib::EventManager* eventManager);
+
+		// The manager of the default world's game data
 		static GameDataManager* Get();
 
 		GameDataManager(const GameDataManager& other) = delete;
@@ -35,7 +40,7 @@ namespace mazer
 		std::string GetSubscriberName() override;
 		void Initialize(bool isNetworkGame);
 
-		static GameData* TheGameData() { return GameData::Get(); }
+		[[nodiscard]] GameData* TheGameData() const { return gameData != nullptr ? gameData : GameData::Get(); }
 		gamelib::GameWorldData GameWorldData{};
 	protected:
 		static GameDataManager* instance;
@@ -44,7 +49,9 @@ namespace mazer
 		void AddToGameData(const std::shared_ptr<gamelib::AddGameObjectToCurrentSceneEvent>& event) const;
 		void RemoveFromGameData(const std::shared_ptr<gamelib::GameObjectEvent>& event);
 		void RemoveGameObject(const std::shared_ptr<gamelib::GameObject>& gameObject) const;
+		void ReloadSettings() const;
 
+		GameData* gameData; // null for the default world's game data
 		gamelib::EventManager* eventManager;
 		gamelib::EventFactory* eventFactory;
 
@@ -6,8 +6,10 @@
 //#include <cppgamelib/character/Direction.h>
 #include <cppgamelib/file/Logger.h>
 #include <cppgamelib/exceptions/EngineException.h>
-#include <cppgamelib/file/SettingsManager.h>
+#include "MazerSettings.h"
 //#include "LevelManager.h"
+#include "MazeGrid.h"
+#include "Room.h"
 #include "RoomInfo.h"
 #include "cppgamelib/character/IMovement.h"
 
@@ -21,19 +23,26 @@ namespace mazer
 		this->roomInfo = roomInfo;
 
 		// Read some config for moving
-		debug = gamelib::SettingsManager::Bool("player", "debugMovement");
-		ignoreRestrictions = gamelib::SettingsManager::Bool("player", "ignoreRestrictions");
+		const auto settings = MazerSettings::Get();
+		debug = settings->Player.DebugMovement;
+		ignoreRestrictions = settings->Player.IgnoreRestrictions;
 	}
 
 	bool GameObjectMoveStrategy::MoveGameObject(const std::shared_ptr<gamelib::IMovement> movement)
+	{
+		return MoveGameObject(*movement);
+	}
+
+	bool GameObjectMoveStrategy::MoveGameObject(gamelib::IMovement& movement)
 	{
 		auto isMoveValid = false;
-		if (IsValidMove(movement))
+		const auto direction = movement.GetDirection();
+		if (IsValidMove(direction))
 		{
 			// Calculate move
-			const auto newPosition = movement->SupportsPositionalMovement()
-				? movement->GetPosition(gameObject->Position)
-				: CalculateGameObjectMove(movement, movement->GetPixelsToMove());
+			const auto newPosition = movement.SupportsPositionalMovement()
+				? movement.GetPosition(gameObject->Position)
+				: CalculateGameObjectMove(direction, movement.GetPixelsToMove());
 
 			// Move
 			SetGameObjectPosition(newPosition);
@@ -42,13 +51,24 @@ namespace mazer
 		return isMoveValid;
 	}
 
-	gamelib::Coordinate<int> GameObjectMoveStrategy::CalculateGameObjectMove(
-		const std::shared_ptr<gamelib::IMovement>& movement, const int pixelsToMove) const
+	bool GameObjectMoveStrategy::MoveGameObject(gamelib::IGameObjectMoveStrategy& strategy, gamelib::IMovement& movement)
+	{
+		if (auto* ownStrategy = dynamic_cast<GameObjectMoveStrategy*>(&strategy))
+		{
+			return ownStrategy->MoveGameObject(movement);
+		}
+
+		// Shares the movement with no control block, so nothing is allocated and nothing deletes it
+		return strategy.MoveGameObject(std::shared_ptr<gamelib::IMovement>(std::shared_ptr<gamelib::IMovement>(), &movement));
+	}
+
+	gamelib::Coordinate<int> GameObjectMoveStrategy::CalculateGameObjectMove(const gamelib::Direction direction,
+		const int pixelsToMove) const
 	{
 		int y = gameObject->Position.GetY();
 		int x = gameObject->Position.GetX();
 
-		switch (movement->GetDirection())
+		switch (direction)
 		{
 		case gamelib::Direction::Down: y += pixelsToMove;	break;
 		case gamelib::Direction::Up: y -= pixelsToMove; 	break;
@@ -68,10 +88,15 @@ namespace mazer
 	}
 
 	bool GameObjectMoveStrategy::IsValidMove(const std::shared_ptr<gamelib::IMovement>& movement)
+	{
+		return IsValidMove(movement->GetDirection());
+	}
+
+	bool GameObjectMoveStrategy::IsValidMove(const gamelib::Direction direction)
 	{
 		if (ignoreRestrictions) { return true; }
 
-		switch (movement->GetDirection())
+		switch (direction)
 		{
 		case gamelib::Direction::Down: return CanGameObjectMove(gamelib::Direction::Down);
 		case gamelib::Direction::Left: return CanGameObjectMove(gamelib::Direction::Left);
@@ -82,58 +107,66 @@ namespace mazer
 		return false;
 	}
 
-	bool GameObjectMoveStrategy::CanGameObjectMove(gamelib::Direction direction)
+	bool GameObjectMoveStrategy::CanGameObjectMove(const gamelib::Direction direction)
 	{
-		std::shared_ptr<Room> targetRoom;
-		bool touchingBlockingWalls = false;
-		bool hasValidTargetRoom; // is the determined target room valid?
-		const auto currentRoom = roomInfo->GetCurrentRoom();
-
-		if (!currentRoom) { return false; }
-
-		auto intersectsRectAndLine = [=](const SDL_Rect bounds, gamelib::Line line) -> bool
-			{
-				return SDL_IntersectRectAndLine(&bounds, &line.X1, &line.Y1, &line.X2, &line.Y2);
-			};
+		if (direction == gamelib::Direction::None) { return roomInfo->GetCurrentRoom() != nullptr; }
+		return (GetMovePermissions() & GetMovePermission(direction)) != 0;
+	}
 
-		if (direction == gamelib::Direction::Right)
+	std::uint8_t GameObjectMoveStrategy::GetMovePermission(const gamelib::Direction direction)
+	{
+		switch (direction)
 		{
-			targetRoom = roomInfo->GetRightRoom();
-			hasValidTargetRoom = targetRoom != nullptr;
-			touchingBlockingWalls =
-				(hasValidTargetRoom && targetRoom->HasLeftWall() && intersectsRectAndLine(
-					gameObject->Bounds, targetRoom->LeftLine)) ||
-				currentRoom->HasRightWall() && intersectsRectAndLine(gameObject->Bounds, currentRoom->RightLine);
+		case gamelib::Direction::Up: return CanMoveUp;
+		case gamelib::Direction::Down: return CanMoveDown;
+		case gamelib::Direction::Left: return CanMoveLeft;
+		case gamelib::Direction::Right: return CanMoveRight;
+		default: return 0;
 		}
-		else if (direction == gamelib::Direction::Left)
-		{
-			targetRoom = roomInfo->GetLeftRoom();
-			hasValidTargetRoom = targetRoom != nullptr;
+	}
 
-			touchingBlockingWalls =
-				(hasValidTargetRoom && targetRoom->HasRightWall() && intersectsRectAndLine(
-					gameObject->Bounds, targetRoom->RightLine)) ||
-				currentRoom->HasLeftWall() && intersectsRectAndLine(gameObject->Bounds, currentRoom->LeftLine);
-		}
-		else if (direction == gamelib::Direction::Up)
-		{
-			targetRoom = roomInfo->GetTopRoom();
-			hasValidTargetRoom = targetRoom != nullptr;
-			touchingBlockingWalls =
-				(hasValidTargetRoom && targetRoom->HasBottomWall() && intersectsRectAndLine(
-					gameObject->Bounds, targetRoom->BottomLine)) ||
-				currentRoom->HasTopWall() && intersectsRectAndLine(gameObject->Bounds, currentRoom->TopLine);
-		}
-		else if (direction == gamelib::Direction::Down)
+	std::uint8_t GameObjectMoveStrategy::GetMovePermissions()
+	{
+		const auto* currentRoom = roomInfo->GetCurrentRoom();
+		if (!currentRoom) { return 0; }
+
+		const auto& bounds = gameObject->Bounds;
+		const auto wallVersion = currentRoom->GetGrid()->GetVersion();
+		if (currentRoom != permittedRoom || wallVersion != permittedWallVersion || bounds.x != permittedBounds.x ||
+			bounds.y != permittedBounds.y || bounds.w != permittedBounds.w || bounds.h != permittedBounds.h)
 		{
-			targetRoom = roomInfo->GetBottomRoom();
-			hasValidTargetRoom = targetRoom != nullptr;
-			touchingBlockingWalls =
-				(hasValidTargetRoom && targetRoom->HasTopWall() && intersectsRectAndLine(
-					gameObject->Bounds, targetRoom->TopLine)) ||
-				currentRoom->HasBottomWall() && intersectsRectAndLine(gameObject->Bounds, currentRoom->BottomLine);
+			permissions = CalculateMovePermissions(*currentRoom);
+			permittedRoom = currentRoom;
+			permittedBounds = bounds;
+			permittedWallVersion = wallVersion;
 		}
+		return permissions;
+	}
 
-		return !touchingBlockingWalls;
+	std::uint8_t GameObjectMoveStrategy::CalculateMovePermissions(const Room& room) const
+	{
+		// The game object cannot move through a wall of its room that its bounds touch. Walls are horizontal or
+		// vertical lines along the edges of the room, so whether the bounds touch one, which is what
+		// SDL_IntersectRectAndLine answered, comes down to comparing coordinates. A wall is shared with the room
+		// on the other side, so it blocks the way the same whichever of the two rooms it is looked at from
+		const auto& bounds = gameObject->Bounds;
+		if (bounds.w <= 0 || bounds.h <= 0) { return CanMoveUp | CanMoveDown | CanMoveLeft | CanMoveRight; }
+
+		const auto left = room.GetX();
+		const auto top = room.GetY();
+		const auto right = left + room.GetWidth();
+		const auto bottom = top + room.GetHeight();
+		const auto lastX = bounds.x + bounds.w - 1;
+		const auto lastY = bounds.y + bounds.h - 1;
+
+		const auto acrossRoom = bounds.x <= right && lastX >= left; // touches the horizontal walls if level with them
+		const auto downRoom = bounds.y <= bottom && lastY >= top; // touches the vertical walls if level with them
+		const auto blockedUp = acrossRoom && bounds.y <= top && top <= lastY && room.HasTopWall();
+		const auto blockedDown = acrossRoom && bounds.y <= bottom && bottom <= lastY && room.HasBottomWall();
+		const auto blockedLeft = downRoom && bounds.x <= left && left <= lastX && room.HasLeftWall();
+		const auto blockedRight = downRoom && bounds.x <= right && right <= lastX && room.HasRightWall();
+
+		return static_cast<std::uint8_t>((blockedUp ? 0 : CanMoveUp) | (blockedDown ? 0 : CanMoveDown) |
+			(blockedLeft ? 0 : CanMoveLeft) | (blockedRight ? 0 : CanMoveRight));
 	}
 }
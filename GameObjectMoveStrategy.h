@@ -2,6 +2,7 @@
 
 //#include <cppgamelib/character/Direction.h>
 
+#include <cstdint>
 #include <cppgamelib/character/Direction.h>
 
 #include "ElapsedGameTimeProvider.h"
@@ -18,24 +19,46 @@ namespace mazer
 	class GameObjectMoveStrategy final : public gamelib::IGameObjectMoveStrategy
 	{
 	public:
+		// One bit per direction in the move permissions
+		enum MovePermission : std::uint8_t { CanMoveUp = 1, CanMoveDown = 2, CanMoveLeft = 4, CanMoveRight = 8 };
+
 		GameObjectMoveStrategy(const std::shared_ptr<gamelib::GameObject>& gameObject,
 			const std::shared_ptr<RoomInfo>& roomInfo);
 
 		// Move it
 		bool MoveGameObject(std::shared_ptr<gamelib::IMovement> movement) override;
+
+		// Moves by a movement the caller keeps, e.g. on the stack, so that moving allocates nothing
+		bool MoveGameObject(gamelib::IMovement& movement);
+
+		// As above through any move strategy. Others take the movement shared without an owner, as they do not keep it
+		static bool MoveGameObject(gamelib::IGameObjectMoveStrategy& strategy, gamelib::IMovement& movement);
 		[[nodiscard]] bool CanGameObjectMove(gamelib::Direction direction) override;
 
+		// The directions the game object can move in, worked out for all four at once. Kept until the game object's
+		// bounds, its room or the walls of the maze change, so asking again in the same tick is a few compares
+		[[nodiscard]] std::uint8_t GetMovePermissions();
+		static std::uint8_t GetMovePermission(gamelib::Direction direction);
+
 	private:
+		[[nodiscard]] std::uint8_t CalculateMovePermissions(const Room& room) const;
 
 
 		void SetGameObjectPosition(gamelib::Coordinate<int> resultingMove) const;
-		[[nodiscard]] gamelib::Coordinate<int> CalculateGameObjectMove(const std::shared_ptr<gamelib::IMovement>& movement,
+		[[nodiscard]] gamelib::Coordinate<int> CalculateGameObjectMove(gamelib::Direction direction,
 			int pixelsToMove) const;
 		[[nodiscard]] bool IsValidMove(const std::shared_ptr<gamelib::IMovement>& movement) override;
+		[[nodiscard]] bool IsValidMove(gamelib::Direction direction);
 
 		std::shared_ptr<gamelib::GameObject> gameObject;
 		std::shared_ptr<RoomInfo> roomInfo;
 		bool ignoreRestrictions;
 		bool debug;
+
+		// What the move permissions were worked out from
+		std::uint8_t permissions = 0;
+		const Room* permittedRoom = nullptr;
+		SDL_Rect permittedBounds{};
+		std::uint32_t permittedWallVersion = 0;
 	};
 }
@@ -0,0 +1,170 @@
+#pragma once
+#ifndef GAMEOBJECTREGISTRY_H
+#define GAMEOBJECTREGISTRY_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace mazer
+{
+	/**
+	 * \brief Game objects by id, with constant time add, remove and lookup.
+	 *
+	 * The objects are kept in a dense array, so iterating over them is a walk over contiguous memory. An
+	 * open-addressing hash index maps each id to its position in the array. Removing an object moves the last object
+	 * into its place, so the order of the objects changes as objects are removed.
+	 *
+	 * The registry does not own the objects. Entries of objects that no longer exist are dropped before the index
+	 * grows, or by RemoveExpired.
+	 */
+	template <typename T>
+	class GameObjectRegistry
+	{
+	public:
+		using Key = std::int64_t;
+		using Entry = std::weak_ptr<T>;
+		using const_iterator = typename std::vector<Entry>::const_iterator;
+
+		// Adds the object, returns false if an object with the same id is already registered
+		bool Add(const Key key, const std::shared_ptr<T>& object)
+		{
+			if (FindSlot(key) != Empty) { return false; }
+
+			// Keep the index at most half full so that probe sequences stay short
+			if ((static_cast<std::size_t>(objects.size()) + 1) * 2 > slots.size())
+			{
+				RemoveExpired();
+				if ((static_cast<std::size_t>(objects.size()) + 1) * 2 > slots.size()) { Rehash(slots.empty() ? 16 : slots.size() * 2); }
+			}
+
+			const auto position = static_cast<int>(objects.size());
+			objects.push_back(object);
+			keys.push_back(key);
+			Insert(key, position);
+			return true;
+		}
+
+		// Removes the object with the id, returns false if there was none
+		bool Remove(const Key key)
+		{
+			const auto slot = FindSlot(key);
+			if (slot == Empty) { return false; }
+
+			const auto position = slots[slot];
+			EraseSlot(slot);
+
+			// Fill the hole with the last object
+			const auto last = static_cast<int>(objects.size()) - 1;
+			if (position != last)
+			{
+				objects[position] = std::move(objects[last]);
+				keys[position] = keys[last];
+				slots[FindSlot(keys[position])] = position;
+			}
+			objects.pop_back();
+			keys.pop_back();
+			return true;
+		}
+
+		[[nodiscard]] bool Contains(const Key key) const { return FindSlot(key) != Empty; }
+
+		// The object with the id, or null if there is none or it no longer exists
+		[[nodiscard]] std::shared_ptr<T> Find(const Key key) const
+		{
+			const auto slot = FindSlot(key);
+			return slot != Empty ? objects[slots[slot]].lock() : nullptr;
+		}
+
+		// Drops the entries of objects that no longer exist
+		void RemoveExpired()
+		{
+			for (auto position = static_cast<int>(objects.size()) - 1; position >= 0; position--)
+			{
+				if (objects[position].expired()) { Remove(keys[position]); }
+			}
+		}
+
+		[[nodiscard]] const std::vector<Entry>& GetObjects() const { return objects; }
+
+		// Container-like access, so the registry can stand in for the vector of objects it replaced
+		[[nodiscard]] std::size_t size() const { return objects.size(); }
+		[[nodiscard]] bool empty() const { return objects.empty(); }
+		[[nodiscard]] const Entry& operator[](const std::size_t position) const { return objects[position]; }
+		[[nodiscard]] const_iterator begin() const { return objects.begin(); }
+		[[nodiscard]] const_iterator end() const { return objects.end(); }
+
+		void clear()
+		{
+			objects.clear();
+			keys.clear();
+			slots.assign(slots.size(), Empty);
+		}
+
+	private:
+		static constexpr int Empty = -1;
+
+		[[nodiscard]] std::size_t Home(const Key key) const
+		{
+			// Fibonacci hashing: ids are usually sequential, multiplying spreads them over the whole index
+			return static_cast<std::size_t>((static_cast<std::uint64_t>(key) * 0x9E3779B97F4A7C15ull) >> 32) & (slots.size() - 1);
+		}
+
+		// Slot in the index holding the key, or Empty
+		[[nodiscard]] int FindSlot(const Key key) const
+		{
+			if (slots.empty()) { return Empty; }
+
+			for (auto slot = Home(key);; slot = (slot + 1) & (slots.size() - 1))
+			{
+				if (slots[slot] == Empty) { return Empty; }
+				if (keys[slots[slot]] == key) { return static_cast<int>(slot); }
+			}
+		}
+
+		void Insert(const Key key, const int position)
+		{
+			auto slot = Home(key);
+			while (slots[slot] != Empty) { slot = (slot + 1) & (slots.size() - 1); }
+			slots[slot] = position;
+		}
+
+		// Linear probing without tombstones: entries after the hole that could live in it move back
+		void EraseSlot(int slot)
+		{
+			const auto mask = slots.size() - 1;
+			auto next = static_cast<std::size_t>(slot);
+
+			while (true)
+			{
+				next = (next + 1) & mask;
+				if (slots[next] == Empty) { break; }
+
+				const auto home = Home(keys[slots[next]]);
+				const auto distanceFromHome = (next - home) & mask;
+				const auto distanceToHole = (next - static_cast<std::size_t>(slot)) & mask;
+				if (distanceFromHome >= distanceToHole)
+				{
+					slots[slot] = slots[next];
+					slot = static_cast<int>(next);
+				}
+			}
+			slots[slot] = Empty;
+		}
+
+		void Rehash(const std::size_t slotCount)
+		{
+			slots.assign(slotCount, Empty);
+			for (auto position = 0; position < static_cast<int>(keys.size()); position++)
+			{
+				Insert(keys[position], position);
+			}
+		}
+
+		std::vector<Entry> objects;
+		std::vector<Key> keys; // id of each object in objects
+		std::vector<int> slots; // the index: position in objects, or Empty
+	};
+}
+
+#endif
@@ -0,0 +1,117 @@
+#include "JobSystem.h"
+#include <algorithm>
+
+namespace mazer
+{
+	JobSystem::JobSystem(unsigned int threads)
+	{
+		if (threads == 0) { threads = std::max(1u, std::thread::hardware_concurrency()); }
+
+		for (auto i = 0u; i < threads; i++) { queues.push_back(std::make_unique<Queue>()); }
+		for (auto i = 1u; i < threads; i++) { workers.emplace_back(&JobSystem::Work, this, i); }
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard lock(wakeMutex);
+			stopping = true;
+		}
+		wake.notify_all();
+		for (auto& worker : workers) { worker.join(); }
+	}
+
+	void JobSystem::ParallelFor(const std::size_t count, std::size_t grain, const RangeJob& job)
+	{
+		if (count == 0) { return; }
+		grain = std::max<std::size_t>(grain, 1);
+
+		// Not worth waking anyone for
+		if (queues.size() == 1 || count <= grain)
+		{
+			job(0, count);
+			return;
+		}
+
+		// The job is set before any chunk is queued, for workers still looking for chunks of the last range
+		const auto chunks = (count + grain - 1) / grain;
+		this->job = &job;
+		remaining.store(chunks, std::memory_order_release);
+
+		// Deal the chunks out round robin, so each thread starts on work of its own
+		for (std::size_t i = 0; i < chunks; i++)
+		{
+			auto& queue = *queues[i % queues.size()];
+			std::lock_guard lock(queue.Mutex);
+			queue.Chunks.push_back({ i * grain, std::min(count, (i + 1) * grain) });
+		}
+
+		{
+			std::lock_guard lock(wakeMutex);
+			batch++;
+		}
+		wake.notify_all();
+
+		// Help until every chunk is done, including the ones other threads are still running
+		Chunk chunk{};
+		while (remaining.load(std::memory_order_acquire) > 0)
+		{
+			if (TakeChunk(0, chunk)) { RunChunk(chunk); }
+			else { std::this_thread::yield(); }
+		}
+
+		this->job = nullptr;
+	}
+
+	bool JobSystem::TakeChunk(const std::size_t thread, Chunk& chunk)
+	{
+		{
+			auto& own = *queues[thread];
+			std::lock_guard lock(own.Mutex);
+			if (!own.Chunks.empty())
+			{
+				chunk = own.Chunks.back();
+				own.Chunks.pop_back();
+				return true;
+			}
+		}
+
+		for (std::size_t i = 1; i < queues.size(); i++)
+		{
+			auto& other = *queues[(thread + i) % queues.size()];
+			std::lock_guard lock(other.Mutex);
+			if (!other.Chunks.empty())
+			{
+				chunk = other.Chunks.front();
+				other.Chunks.pop_front();
+				steals.fetch_add(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void JobSystem::RunChunk(const Chunk& chunk)
+	{
+		(*job)(chunk.Begin, chunk.End);
+		remaining.fetch_sub(1, std::memory_order_acq_rel);
+	}
+
+	void JobSystem::Work(const std::size_t thread)
+	{
+		std::uint64_t seen = 0;
+		while (true)
+		{
+			{
+				std::unique_lock lock(wakeMutex);
+				wake.wait(lock, [&] { return stopping || batch != seen; });
+				if (stopping) { return; }
+				seen = batch;
+			}
+
+			// Work until there is nothing left to take; the caller waits for chunks that are still running
+			Chunk chunk{};
+			while (TakeChunk(thread, chunk)) { RunChunk(chunk); }
+		}
+	}
+}
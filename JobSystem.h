@@ -0,0 +1,80 @@
+#pragma once
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mazer
+{
+	/**
+	 * \brief A pool of worker threads that share out ranges of work by stealing it from each other.
+	 *
+	 * ParallelFor cuts a range into chunks and deals them out to a queue per thread. Each thread works from the back
+	 * of its own queue and, once that is empty, steals from the front of the others, so threads that finish early
+	 * help the ones that did not. The calling thread works too, and ParallelFor returns when every chunk is done.
+	 *
+	 * Jobs must not raise events or otherwise touch shared state: they write their results to their own slots and
+	 * the caller combines them afterwards, in index order, so the outcome does not depend on the number of threads.
+	 * ParallelFor is not re-entrant and is called from one thread at a time.
+	 */
+	class JobSystem
+	{
+	public:
+		// Work on the indices [begin, end) of a range
+		using RangeJob = std::function<void(std::size_t begin, std::size_t end)>;
+
+		// Zero threads means one per hardware thread. The calling thread counts as one of them
+		explicit JobSystem(unsigned int threads = 0);
+		~JobSystem();
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		void ParallelFor(std::size_t count, std::size_t grain, const RangeJob& job);
+
+		[[nodiscard]] unsigned int GetThreadCount() const { return static_cast<unsigned int>(queues.size()); }
+
+		// Chunks taken from another thread's queue so far
+		[[nodiscard]] std::size_t GetSteals() const { return steals.load(std::memory_order_relaxed); }
+
+	private:
+		struct Chunk
+		{
+			std::size_t Begin;
+			std::size_t End;
+		};
+
+		struct Queue
+		{
+			std::mutex Mutex;
+			std::deque<Chunk> Chunks;
+		};
+
+		// Takes a chunk from the back of the thread's own queue, or steals one from the front of another
+		bool TakeChunk(std::size_t thread, Chunk& chunk);
+		void RunChunk(const Chunk& chunk);
+		void Work(std::size_t thread);
+
+		std::vector<std::unique_ptr<Queue>> queues; // queue 0 is the calling thread's
+		std::vector<std::thread> workers;
+
+		std::mutex wakeMutex;
+		std::condition_variable wake;
+		std::uint64_t batch = 0; // bumped for each ParallelFor, guarded by wakeMutex
+		bool stopping = false;
+
+		const RangeJob* job = nullptr;
+		std::atomic<std::size_t> remaining{ 0 };
+		std::atomic<std::size_t> steals{ 0 };
+	};
+}
+
+#endif
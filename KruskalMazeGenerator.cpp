@@ -0,0 +1,71 @@
+#include "KruskalMazeGenerator.h"
+#include <algorithm>
+#include <vector>
+
+#include "DisjointSet.h"
+#include "MazeGrid.h"
+#include "RandomStream.h"
+
+namespace mazer
+{
+	namespace
+	{
+		// An inner wall is the right (even) or bottom (odd) wall of a room
+		int RightWall(const int room) { return room * 2; }
+		int BottomWall(const int room) { return room * 2 + 1; }
+	}
+
+	KruskalMazeGenerator::KruskalMazeGenerator(const int rows, const int columns, const std::uint64_t seed,
+		const double braid)
+		: rows(rows), columns(columns), seed(seed), braid(std::clamp(braid, 0.0, 1.0))
+	{
+	}
+
+	std::shared_ptr<MazeGrid> KruskalMazeGenerator::GenerateGrid() const
+	{
+		auto grid = std::make_shared<MazeGrid>(rows, columns);
+		Generate(*grid);
+		return grid;
+	}
+
+	void KruskalMazeGenerator::Generate(MazeGrid& grid) const
+	{
+		std::vector<int> walls;
+		walls.reserve(static_cast<std::size_t>(rows) * columns * 2);
+
+		for (auto room = 0; room < rows * columns; room++)
+		{
+			if (room % columns < columns - 1) { walls.push_back(RightWall(room)); }
+			if (room / columns < rows - 1) { walls.push_back(BottomWall(room)); }
+		}
+
+		auto random = RandomStream(seed).Derive(RandomDomain::Rooms);
+		random.Shuffle(walls.begin(), walls.end());
+
+		// Walls that stay up are moved to the front. They are still in random order, so re-opening the first
+		// of them picks a random subset.
+		DisjointSet rooms(rows * columns);
+		auto closed = 0;
+
+		for (const auto wall : walls)
+		{
+			const auto room = wall / 2;
+			const auto neighbor = wall % 2 == 0 ? room + 1 : room + columns;
+
+			if (rooms.Union(room, neighbor))
+			{
+				grid.RemoveWall(room, wall % 2 == 0 ? gamelib::Side::Right : gamelib::Side::Bottom);
+			}
+			else
+			{
+				walls[closed++] = wall;
+			}
+		}
+
+		const auto toOpen = static_cast<int>(closed * braid + 0.5);
+		for (auto i = 0; i < toOpen; i++)
+		{
+			grid.RemoveWall(walls[i] / 2, walls[i] % 2 == 0 ? gamelib::Side::Right : gamelib::Side::Bottom);
+		}
+	}
+}
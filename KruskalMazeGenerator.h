@@ -0,0 +1,38 @@
+#pragma once
+#ifndef KRUSKALMAZEGENERATOR_H
+#define KRUSKALMAZEGENERATOR_H
+
+#include <cstdint>
+#include <memory>
+
+namespace mazer
+{
+	class MazeGrid;
+
+	/**
+	 * \brief Generates a maze with randomised Kruskal's algorithm.
+	 *
+	 * Inner walls are visited in random order and removed when they separate rooms that are not yet connected, so
+	 * every room is reachable from every other room. The braid factor then re-opens that fraction of the remaining
+	 * inner walls to add loops: 0 gives a perfect maze, 1 removes every inner wall.
+	 */
+	class KruskalMazeGenerator
+	{
+	public:
+		KruskalMazeGenerator(int rows, int columns, std::uint64_t seed, double braid = 0.0);
+
+		// Generates into the grid, which must be fully walled
+		void Generate(MazeGrid& grid) const;
+		[[nodiscard]] std::shared_ptr<MazeGrid> GenerateGrid() const;
+
+		[[nodiscard]] double GetBraid() const { return braid; }
+
+	private:
+		int rows;
+		int columns;
+		std::uint64_t seed;
+		double braid;
+	};
+}
+
+#endif
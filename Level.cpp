@@ -2,18 +2,24 @@
 
 #include <algorithm>
 #include <common/constants.h>
-#include <cppgamelib/events/PlayerMovedEvent.h>
 #include <cppgamelib/file/SettingsManager.h>
+#include "MazerSettings.h"
 #include <geometry/Side.h>
 #include <utils/Utils.h>
 
 #include "CharacterBuilder.h"
 #include "GameDataManager.h"
 #include "GameObjectMoveStrategy.h"
+#include "KruskalMazeGenerator.h"
+#include "BinaryLevel.h"
+#include "MappedFile.h"
+#include "MazeGrid.h"
+#include "RandomService.h"
 #include "Room.h"
 #include "RoomGenerator.h"
 #include "Rooms.h"
-#include <tinyxml2.h>
+#include "TiledMazeGenerator.h"
+#include "XmlStreamReader.h"
 #include "cppgamelib/character/AnimatedSprite.h"
 //
 #include <cppgamelib/events/EventFactory.h>
@@ -21,32 +27,118 @@
 
 #include "pickup.h"
 #include "Player.h"
-#include "cppgamelib/character/DirectionUtils.h"
 #include <cppgamelib/events/AddGameObjectToCurrentSceneEvent.h>
 
-using namespace tinyxml2;
 using namespace std;
 using namespace gamelib;
 
 namespace mazer
 {
 
-	Level::Level(const std::string& filename) : NumCols(0), NumRows(0), ScreenWidth(0), ScreenHeight(0), isAutoLevel(false)
+	// Builds a level from XML elements as they are read
+	class Level::XmlLevelHandler final : public IXmlStreamHandler
+	{
+	public:
+		explicit XmlLevelHandler(Level& level) : level(level) {}
+
+		void OnStartElement(const std::string_view name, const XmlAttributes& attributes) override
+		{
+			if (name == "level") { OnLevel(attributes); }
+			else if (name == "room") { OnRoom(attributes); }
+			else if (name == "object") { OnObject(attributes); }
+			else if (name == "property" && currentObject)
+			{
+				currentObject->StringProperties[string(attributes.Get("name"))] = string(attributes.Get("value"));
+			}
+		}
+
+		void OnEndElement(const std::string_view name) override
+		{
+			if (name == "object" && currentObject)
+			{
+				level.AddObject(currentObject);
+				currentObject = nullptr;
+			}
+			else if (name == "room")
+			{
+				currentRoom = nullptr;
+			}
+		}
+
+	private:
+		void OnLevel(const XmlAttributes& attributes) const
+		{
+			level.NumCols = attributes.GetInt("cols");
+			level.NumRows = attributes.GetInt("rows");
+			if (level.NumCols <= 0 || level.NumRows <= 0) { return; }
+
+			// Check if the level file specifies that we should automatically create pickups for the level
+			level.isAutoPopulatePickups = attributes.GetBool("autoPopulatePickups", true);
+
+			// Levels saved with a seed are reproduced exactly, others get a new seed each time they are loaded
+			level.Seed = attributes.Has("seed") ? attributes.GetUnsigned64("seed") : RandomService::MakeSeed();
+
+			// Read some config that specifies how big the screen is
+			level.ScreenWidth = SettingsManager::Int("global", "screen_width");
+			level.ScreenHeight = SettingsManager::Int("global", "screen_height");
+
+			// Walls shared by two rooms are stored once in the grid, so start with no walls and add every wall that
+			// either of the rooms on each side of it declares
+			level.Grid = std::make_shared<MazeGrid>(level.NumRows, level.NumCols, false);
+			level.Rooms.reserve(level.Grid->GetRoomCount());
+		}
+
+		void OnRoom(const XmlAttributes& attributes)
+		{
+			const auto number = attributes.GetInt("number", -1);
+			if (level.Grid == nullptr || !level.Grid->IsValidIndex(number)) { return; }
+
+			// Deserialize a room
+			currentRoom = level.CreateRoom(number);
+
+			if (attributes.Get("right") == "True") { currentRoom->AddWall(Side::Right); }
+			if (attributes.Get("left") == "True") { currentRoom->AddWall(Side::Left); }
+			if (attributes.Get("top") == "True") { currentRoom->AddWall(Side::Top); }
+			if (attributes.Get("bottom") == "True") { currentRoom->AddWall(Side::Bottom); }
+
+			level.Rooms.push_back(currentRoom);
+		}
+
+		void OnObject(const XmlAttributes& attributes)
+		{
+			if (currentRoom == nullptr) { return; }
+
+			// Create whatever Game Object the object represents, its properties follow
+			currentObject = level.BuildObject(string(attributes.Get("name")), string(attributes.Get("type")),
+				attributes.GetInt("resourceId"), currentRoom);
+		}
+
+		Level& level;
+		std::shared_ptr<Room> currentRoom;
+		std::shared_ptr<GameObject> currentObject;
+	};
+
+	Level::Level(const std::string& filename, World& world) : NumCols(0), NumRows(0), ScreenWidth(0), ScreenHeight(0), Seed(0),
+		world(&world), isAutoLevel(false)
 	{
 		FileName = filename;
 		isAutoPopulatePickups = true;
 	}
 
-	Level::Level()
+	Level::Level(World& world) : world(&world)
 	{
 		isAutoLevel = true;
 		isAutoPopulatePickups = true;
 
 		// Read config for level creation:
-		NumRows = SettingsManager::Int("grid", "rows");
-		NumCols = SettingsManager::Int("grid", "cols");
+		const auto settings = MazerSettings::Get();
+		NumRows = settings->Grid.Rows;
+		NumCols = settings->Grid.Columns;
 		ScreenWidth = SettingsManager::Int("global", "screen_width");
 		ScreenHeight = SettingsManager::Int("global", "screen_height");
+
+		// A seed of 0 means a different level every time
+		Seed = settings->Grid.Seed;
 	}
 
 
@@ -55,147 +147,169 @@ namespace mazer
 		if (IsAutoLevel())
 		{
 			// Get Auto Level creation options:
-			const auto removeRandomSidesOption = SettingsManager::Bool("grid", "removeSidesRandomly");
+			const auto settings = MazerSettings::Get();
+			const auto removeRandomSidesOption = settings->Grid.RemoveSidesRandomly;
+
+			if (Seed == 0) { Seed = RandomService::MakeSeed(); }
 
-			Rooms = RoomGenerator(static_cast<int>(ScreenWidth),
+			const RoomGenerator generator(static_cast<int>(ScreenWidth),
 				static_cast<int>(ScreenHeight),
 				NumRows, NumCols,
-				removeRandomSidesOption).Generate();
+				removeRandomSidesOption, Seed);
+
+			// Large levels can be generated in parallel, tile by tile
+			if (settings->Grid.TiledGeneration)
+			{
+				const TiledMazeGenerator tiledGenerator(NumRows, NumCols, Seed);
+				Grid = tiledGenerator.GenerateGrid(settings->Grid.GeneratorThreads);
+			}
+			else if (settings->Grid.PerfectMaze)
+			{
+				// Every room is reachable, braiding re-opens a percentage of the remaining walls to add loops
+				const KruskalMazeGenerator kruskalGenerator(NumRows, NumCols, Seed,
+					settings->Grid.BraidPercent / 100.0);
+				Grid = kruskalGenerator.GenerateGrid();
+			}
+			else
+			{
+				Grid = generator.GenerateGrid();
+			}
+
+			Rooms = generator.CreateRooms(Grid, *world);
 			return;
 		}
 
-		XMLDocument doc;
+		if (IsBinaryLevel())
+		{
+			LoadBinary();
+			return;
+		}
 
-		doc.LoadFile(FileName.c_str());
+		// Rooms and objects are created as their elements are read, the document is never held in memory
+		XmlLevelHandler handler(*this);
+		XmlStreamReader reader;
 
-		if (doc.ErrorID() == 0)
+		if (!reader.ParseFile(FileName, handler) || Grid == nullptr)
 		{
-			auto* scene = doc.FirstChildElement("level");
-			NumCols = std::strtol(scene->ToElement()->Attribute("cols"), nullptr, 0);
-			NumRows = std::strtol(scene->ToElement()->Attribute("rows"), nullptr, 0);
+			// Nothing is loaded from a broken level
+			Grid = nullptr;
+			Rooms.clear();
+			Pickups.clear();
+			Enemies.clear();
+			Player1 = nullptr;
+			return;
+		}
 
-			// Check if the level file specifies that we should automatically create pickups for the level
-			if (auto autoPopulatePickups = scene->ToElement()->Attribute("autoPopulatePickups"))
-			{
-				auto strToTransform = string(autoPopulatePickups);
-				std::transform(strToTransform.begin(), strToTransform.end(), strToTransform.begin(),
-				       [](unsigned char c){ return std::toupper(c); });
+		Rooms::ConfigureRooms(Rooms);
 
-				isAutoPopulatePickups = strToTransform == "TRUE";
-			}
+		// Initialize all the objects we deserialized
+		InitializePickups(Pickups);
+		InitializeEnemies();
+	}
 
-			// Read some config that specifies how big the screen is
-			ScreenWidth = SettingsManager::Int("global", "screen_width");
-			ScreenHeight = SettingsManager::Int("global", "screen_height");
+	void Level::LoadBinary()
+	{
+		// The file is mapped rather than read, and used in place: nothing is parsed
+		const MappedFile file(FileName);
+		const BinaryLevel level(file.GetData(), file.GetSize());
 
-			// List of Rooms generated
+		if (!level.IsValid()) { return; }
 
-			for (auto roomNode = scene->FirstChild(); roomNode; roomNode = roomNode->NextSibling()) //  <room ...>
+		NumRows = level.GetRows();
+		NumCols = level.GetColumns();
+		isAutoPopulatePickups = level.IsAutoPopulatePickups();
+		// A level baked without a seed stores 0, and gets a new one each time it is played as the XML level does
+		Seed = level.GetSeed() != 0 ? level.GetSeed() : RandomService::MakeSeed();
+
+		ScreenWidth = SettingsManager::Int("global", "screen_width");
+		ScreenHeight = SettingsManager::Int("global", "screen_height");
+
+		Grid = std::make_shared<MazeGrid>(NumRows, NumCols, false);
+		level.CopyWallsTo(*Grid);
+
+		Rooms.reserve(Grid->GetRoomCount());
+		for (auto number = 0; number < Grid->GetRoomCount(); number++)
+		{
+			Rooms.push_back(CreateRoom(number));
+		}
+
+		// Objects are stored in room order, so they are created in the same order as from the XML level
+		for (auto i = 0; i < level.GetObjectCount(); i++)
+		{
+			const auto object = level.GetObject(i);
+			const auto gameObject = BuildObject(string(object.Name), string(object.Type), object.ResourceId,
+				Rooms[object.Room]);
+
+			for (auto property = 0; property < object.PropertyCount; property++)
 			{
-				auto roomElement = roomNode->ToElement();
-				auto number = std::strtol(roomElement->ToElement()->Attribute("number"), nullptr, 0);
-
-				// Get visibility strings for the room sides (True/False)
-				auto topSideVisible = string(roomElement->ToElement()->Attribute("top"));
-				auto rightSideVisible = string(roomElement->ToElement()->Attribute("right"));
-				auto bottomSideVisible = string(roomElement->ToElement()->Attribute("bottom"));
-				auto leftSideVisible = string(roomElement->ToElement()->Attribute("left"));
-
-				auto row = number / NumCols; // row for this roomNumber
-				auto rowCol0 = row * NumCols;
-				auto col = number - rowCol0; // col for this roomNumber
-
-				const auto squareWidth = ScreenWidth / NumCols;
-				const auto squareHeight = ScreenHeight / NumRows;
-				const auto roomName = string("Room") + std::to_string(number);
-
-				// Deserialize a room
-				auto room = std::make_shared<Room>(roomName, "Room", number, col * squareWidth, row * squareHeight,
-					squareWidth, squareHeight, false);
-
-				auto setWall = [&](const std::string& sideVisibilityString, const Side side,
-					const std::shared_ptr<Room>& inRoom) -> void
-					{
-						sideVisibilityString == "True" ? inRoom->AddWall(side) : inRoom->RemoveWall(side);
-					};
-
-				setWall(rightSideVisible, Side::Right, room);
-				setWall(leftSideVisible, Side::Left, room);
-				setWall(topSideVisible, Side::Top, room);
-				setWall(bottomSideVisible, Side::Bottom, room);
-
-				// Set room tag to room number
-				room->SetTag(std::to_string(number));
-
-				// Now process the objects declared inside the room element
-
-				// <object name="xyz" type="abc" ...ie inspect all the objects in the room
-				for (auto pRoomChild = roomNode->FirstChild(); pRoomChild; pRoomChild = pRoomChild->NextSibling())
-				{
-					string roomChildName = pRoomChild->Value();
-					if (roomChildName == "object") // <object ...
-					{
-						// Create whatever Game Object the object represents and return it as a GameObject
-						auto gameObject = ParseObject(pRoomChild, room);
-
-						// We store the player object
-						if (gameObject->Type == "Player")
-						{
-							Player1 = To<Player>(gameObject);
-						}
-
-						// We collect pickup objects
-						if (gameObject->Type == "Pickup" && !IsAutoPopulatePickups())
-						{
-							Pickups.push_back(To<Pickup>(gameObject));
-						}
-
-						// We collect Enemy objects
-						if (gameObject->Type == "Enemy")
-						{
-							Enemies.push_back(To<Enemy>(gameObject));
-						}
-					}
-				}
-				Rooms.push_back(room);
+				const auto [key, value] = level.GetProperty(object, property);
+				gameObject->StringProperties[string(key)] = string(value);
 			}
 
-			Rooms::ConfigureRooms(NumRows, NumCols, Rooms);
-
-			// Initialize all the objects we deserialized
-			InitializePickups(Pickups);
-			InitializeEnemies();
+			AddObject(gameObject);
 		}
+
+		Rooms::ConfigureRooms(Rooms);
+
+		InitializePickups(Pickups);
+		InitializeEnemies();
 	}
 
-	ListOfEvents Level::HandleEvent(const std::shared_ptr<Event>& evt, const unsigned long deltaMs)
+	bool Level::IsBinaryLevel() const
 	{
-		// Level itself does not handle any events
-		return {};
+		return FileName.size() > BinaryLevel::FileExtension.size() &&
+			FileName.compare(FileName.size() - BinaryLevel::FileExtension.size(), BinaryLevel::FileExtension.size(),
+				BinaryLevel::FileExtension) == 0;
+	}
+
+	std::shared_ptr<Room> Level::CreateRoom(const int number) const
+	{
+		const auto row = number / NumCols;
+		const auto col = number % NumCols;
+		const auto squareWidth = static_cast<int>(ScreenWidth) / NumCols;
+		const auto squareHeight = static_cast<int>(ScreenHeight) / NumRows;
+		const auto roomName = string("Room") + std::to_string(number);
+
+		auto room = std::make_shared<Room>(roomName, "Room", Grid, number, col * squareWidth, row * squareHeight,
+			squareWidth, squareHeight, false, *world);
+
+		// Set room tag to room number
+		room->SetTag(std::to_string(number));
+		return room;
 	}
 
-	static map<string, string> GetNodeAttributes(XMLNode* pAssetNode)
+	void Level::AddObject(const std::shared_ptr<GameObject>& gameObject)
 	{
-		map<string, string> attributes;
-		if (pAssetNode)
+		// We store the player object
+		if (gameObject->Type == "Player")
 		{
-			// Nodes need to be converted to elements to access their attributes
-			for (auto attribute = pAssetNode->ToElement()->FirstAttribute(); attribute; attribute = attribute->Next())
-			{
-				const auto* name = attribute->Name();
-				const auto* value = attribute->Value();
-				attributes[name] = value;
-			}
+			Player1 = To<Player>(gameObject);
+		}
+
+		// We collect pickup objects
+		if (gameObject->Type == "Pickup" && !IsAutoPopulatePickups())
+		{
+			Pickups.push_back(To<Pickup>(gameObject));
+		}
+
+		// We collect Enemy objects
+		if (gameObject->Type == "Enemy")
+		{
+			Enemies.push_back(To<Enemy>(gameObject));
 		}
-		return attributes;
+	}
+
+	ListOfEvents Level::HandleEvent(const std::shared_ptr<Event>& evt, const unsigned long deltaMs)
+	{
+		// Level itself does not handle any events
+		return {};
 	}
 
 	void Level::InitializePickups(const std::vector<std::shared_ptr<Pickup>>& inPickups)
 	{
 		for (const auto& pickup : inPickups)
 		{
-			pickup->LoadSettings();
-			pickup->SubscribeToEvent(PlayerMovedEventTypeEventId); // pickup want to know if player moved
+			pickup->LoadSettings(); // the player finds the pickups it touches, from the pickups in its rooms
 
 			AddGameObjectToScene(pickup);
 		}
@@ -206,7 +320,7 @@ namespace mazer
 		for (auto& enemy : Enemies)
 		{
 			enemy->Initialize();
-			GameDataManager::Get()->TheGameData()->AddEnemy(enemy);
+			world->Data().AddEnemy(enemy);
 			AddGameObjectToScene(enemy);
 		}
 	}
@@ -214,71 +328,42 @@ namespace mazer
 	void Level::AddGameObjectToScene(const std::shared_ptr<GameObject>& object)
 	{
 		auto event = EventFactory::CreateAddToSceneEvent(object);
-		EventManager::Get()->RaiseEvent(To<Event>(event), this);
+		world->Events().RaiseEvent(To<Event>(event), this);
 	}
 
-
-	shared_ptr<GameObject> Level::ParseObject(XMLNode* pObject, const std::shared_ptr<Room>& room) const
+	std::shared_ptr<GameObject> Level::BuildObject(const std::string& objectName, const std::string& objectType,
+		const int objectResourceId, const std::shared_ptr<Room>& room) const
 	{
-		const auto attributes = GetNodeAttributes(pObject);
-		const string objectName = attributes.at("name");
-		const string objectType = attributes.at("type");
-		const auto objectResourceId = stoi(attributes.at("resourceId"));
-
 		shared_ptr<GameObject> gameObject;
 
 		// Make Game Objects from the serialized object
 		if (objectType == "Player")
 		{
-			gameObject = CharacterBuilder::BuildPlayer(objectName, room, objectResourceId, "playerNickName");
+			gameObject = CharacterBuilder::BuildPlayer(objectName, room, objectResourceId, "playerNickName", *world);
 		}
 		else if (objectType == "Pickup")
 		{
-			gameObject = CharacterBuilder::BuildPickup(objectName, room, objectResourceId);
+			gameObject = CharacterBuilder::BuildPickup(objectName, room, objectResourceId, *world);
 		}
 		else if (objectType == "Enemy")
 		{
 			gameObject = CharacterBuilder::BuildEnemy(objectName, room, objectResourceId,
-				DirectionUtils::GetRandomDirection(), shared_from_this());
+				RandomService::GetRandomDirection(Seed, RandomDomain::Enemies, Enemies.size()), shared_from_this(), *world);
 		}
 
-		// Look for and add properties to the game object
-		for (auto pObjectChild = pObject->FirstChild(); pObjectChild; pObjectChild = pObjectChild->NextSibling())
-		{
-			string objectChildName = pObjectChild->Value();
-
-			if (objectChildName == "property")
-			{
-				auto keyValuePair = ParseProperty(pObjectChild, gameObject); // hmm, this object has a property attached
-
-				auto key = std::get<0>(keyValuePair);
-				const auto value = std::get<1>(keyValuePair);
-
-				gameObject->StringProperties[key] = value;
-			}
-		}
 		return gameObject;
 	}
 
 	void Level::InitializePlayer(const std::shared_ptr<Player>& inPlayer,
-		const std::shared_ptr<SpriteAsset>& spriteAsset)
+		const std::shared_ptr<SpriteAsset>& spriteAsset) const
 	{
 		inPlayer->SetMoveStrategy(std::make_shared<GameObjectMoveStrategy>(inPlayer, inPlayer->CurrentRoom));
 		inPlayer->SetTag(gamelib::PlayerTag);
 		inPlayer->LoadSettings();
 		inPlayer->SetSprite(AnimatedSprite::Create(inPlayer->Position, spriteAsset));
 
-		// We keep a reference to track of the player globally
-		GameData::Get()->player = inPlayer;
-	}
-
-	std::tuple<std::string, std::string> Level::ParseProperty(XMLNode* pObjectChild, const shared_ptr<GameObject>& gameObject)
-	{
-		const auto& attributes = GetNodeAttributes(pObjectChild);
-		const auto& name = attributes.at("name");
-		const auto& value = attributes.at("value");
-
-		return { name, value };
+		// The world keeps track of its player
+		world->Data().SetPlayer(inPlayer);
 	}
 
 	std::shared_ptr<Room> Level::GetRoom(const int row, const int col)
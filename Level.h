@@ -1,11 +1,13 @@
 #pragma once
 #ifndef LEVEL_H
 #define LEVEL_H
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
 
 #include "Enemy.h"
+#include "World.h"
 #include "events/EventSubscriber.h"
 
 namespace gamelib
@@ -15,11 +17,6 @@ namespace gamelib
 
 }
 
-namespace tinyxml2
-{
-	class XMLNode;
-}
-
 namespace mazer
 {
 
@@ -27,25 +24,30 @@ namespace mazer
 	class Room;
 	class Enemy;
 	class Pickup;
+	class MazeGrid;
 
 	class Level final : public gamelib::EventSubscriber, public std::enable_shared_from_this<Level>
 	{
 	public:
-		explicit Level(const std::string& filename);
-		Level();
+		// The level is loaded into the given world
+		explicit Level(const std::string& filename, World& world = World::Default());
+		explicit Level(World& world = World::Default());
 		void InitializeEnemies();
 		void Load();
 		gamelib::ListOfEvents HandleEvent(const std::shared_ptr<gamelib::Event>& evt, const unsigned long deltaMs) override;
 		std::string GetSubscriberName() override { return "Level"; }
 		void InitializePickups(const std::vector<std::shared_ptr<Pickup>>& inPickups);
 		void AddGameObjectToScene(const std::shared_ptr<gamelib::GameObject>& object);
-		std::shared_ptr<gamelib::GameObject> ParseObject(tinyxml2::XMLNode* pObject, const std::shared_ptr<Room>& room) const;
-		static void InitializePlayer(const std::shared_ptr<Player>& inPlayer, const std::shared_ptr<gamelib::SpriteAsset>& spriteAsset);
-		static std::tuple<std::string, std::string> ParseProperty(tinyxml2::XMLNode* pObjectChild, const std::shared_ptr<gamelib::GameObject>& gameObject);
+		std::shared_ptr<gamelib::GameObject> BuildObject(const std::string& objectName, const std::string& objectType,
+			int objectResourceId, const std::shared_ptr<Room>& room) const;
+		void InitializePlayer(const std::shared_ptr<Player>& inPlayer, const std::shared_ptr<gamelib::SpriteAsset>& spriteAsset) const;
 		std::shared_ptr<Room> GetRoom(int row, int col);
 		[[nodiscard]] bool IsAutoLevel() const { return isAutoLevel || FileName.empty(); }
 		[[nodiscard]] bool IsAutoPopulatePickups() const { return isAutoPopulatePickups; }
+		[[nodiscard]] bool IsBinaryLevel() const;
+		[[nodiscard]] World& GetWorld() const { return *world; }
 
+		std::shared_ptr<MazeGrid> Grid;
 		std::vector<std::shared_ptr<Room>> Rooms;
 		std::vector<std::shared_ptr<Pickup>> Pickups;
 		std::vector<std::shared_ptr<Enemy>> Enemies;
@@ -55,8 +57,16 @@ namespace mazer
 		int NumRows;
 		unsigned int ScreenWidth;
 		unsigned int ScreenHeight;
+		std::uint64_t Seed; // everything random about the level is derived from this
 
 	private:
+		class XmlLevelHandler;
+
+		void LoadBinary();
+		[[nodiscard]] std::shared_ptr<Room> CreateRoom(int number) const;
+		void AddObject(const std::shared_ptr<gamelib::GameObject>& gameObject);
+
+		World* world;
 		bool isAutoLevel;
 		bool isAutoPopulatePickups;
 	};
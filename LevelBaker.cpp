@@ -0,0 +1,73 @@
+#include "LevelBaker.h"
+#include <memory>
+#include <geometry/Side.h>
+
+#include "BinaryLevel.h"
+#include "MazeGrid.h"
+#include "XmlStreamReader.h"
+
+namespace mazer
+{
+	namespace
+	{
+		// Writes the elements of an XML level into a binary level as they are read
+		class BakingHandler final : public IXmlStreamHandler
+		{
+		public:
+			void OnStartElement(const std::string_view name, const XmlAttributes& attributes) override
+			{
+				if (name == "level")
+				{
+					const auto columns = attributes.GetInt("cols");
+					const auto rows = attributes.GetInt("rows");
+					if (rows <= 0 || columns <= 0) { return; }
+
+					// A wall is up if either room on each side of it declares it, as when loading the XML level
+					Grid = std::make_unique<MazeGrid>(rows, columns, false);
+					Writer = std::make_unique<BinaryLevelWriter>(*Grid, attributes.GetUnsigned64("seed"),
+						attributes.GetBool("autoPopulatePickups", true));
+				}
+				else if (name == "room" && Grid)
+				{
+					room = attributes.GetInt("number", -1);
+					if (!Grid->IsValidIndex(room)) { room = -1; return; }
+
+					if (attributes.Get("top") == "True") { Grid->AddWall(room, gamelib::Side::Top); }
+					if (attributes.Get("right") == "True") { Grid->AddWall(room, gamelib::Side::Right); }
+					if (attributes.Get("bottom") == "True") { Grid->AddWall(room, gamelib::Side::Bottom); }
+					if (attributes.Get("left") == "True") { Grid->AddWall(room, gamelib::Side::Left); }
+				}
+				else if (name == "object" && room != -1)
+				{
+					Writer->AddObject(room, attributes.Get("name"), attributes.Get("type"), attributes.GetInt("resourceId"));
+					isInObject = true;
+				}
+				else if (name == "property" && isInObject)
+				{
+					Writer->SetProperty(attributes.Get("name"), attributes.Get("value"));
+				}
+			}
+
+			void OnEndElement(const std::string_view name) override
+			{
+				if (name == "object") { isInObject = false; }
+				else if (name == "room") { room = -1; }
+			}
+
+			std::unique_ptr<MazeGrid> Grid;
+			std::unique_ptr<BinaryLevelWriter> Writer;
+
+		private:
+			int room = -1;
+			bool isInObject = false;
+		};
+	}
+
+	bool LevelBaker::Bake(const std::string& xmlFileName, const std::string& binaryFileName)
+	{
+		BakingHandler handler;
+		if (!XmlStreamReader().ParseFile(xmlFileName, handler) || handler.Writer == nullptr) { return false; }
+
+		return handler.Writer->Save(binaryFileName);
+	}
+}
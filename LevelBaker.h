@@ -0,0 +1,20 @@
+#pragma once
+#ifndef LEVELBAKER_H
+#define LEVELBAKER_H
+
+#include <string>
+
+namespace mazer
+{
+	/**
+	 * \brief Converts XML levels into binary levels that load without parsing
+	 */
+	class LevelBaker
+	{
+	public:
+		// Returns false if the XML level cannot be read or the binary level cannot be written
+		static bool Bake(const std::string& xmlFileName, const std::string& binaryFileName);
+	};
+}
+
+#endif
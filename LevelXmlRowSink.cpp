@@ -0,0 +1,45 @@
+#include "LevelXmlRowSink.h"
+
+namespace mazer
+{
+	LevelXmlRowSink::LevelXmlRowSink(std::ostream& output, const bool autoPopulatePickups, const std::uint64_t seed)
+		: output(output), autoPopulatePickups(autoPopulatePickups), seed(seed)
+	{
+	}
+
+	void LevelXmlRowSink::OnBegin(const int rows, const int columns)
+	{
+		// The first row's top walls are the outer wall of the maze
+		topWalls.assign(columns, true);
+
+		output << "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n";
+		output << "<level cols=\"" << columns << "\" rows=\"" << rows << "\" autoPopulatePickups=\""
+			<< (autoPopulatePickups ? "True" : "False") << "\"";
+		if (seed != 0) { output << " seed=\"" << seed << "\""; }
+		output << ">\n";
+	}
+
+	void LevelXmlRowSink::OnRow(const MazeRow& row)
+	{
+		auto toString = [](const bool walled) { return walled ? "True" : "False"; };
+		const auto columns = row.GetColumns();
+
+		for (auto column = 0; column < columns; column++)
+		{
+			const auto leftWall = column == 0 || row.HasRightWall(column - 1);
+
+			output << "  <room number=\"" << static_cast<long long>(row.Row) * columns + column
+				<< "\" top=\"" << toString(topWalls[column])
+				<< "\" right=\"" << toString(row.HasRightWall(column))
+				<< "\" bottom=\"" << toString(row.HasBottomWall(column))
+				<< "\" left=\"" << toString(leftWall) << "\" />\n";
+
+			topWalls[column] = row.HasBottomWall(column);
+		}
+	}
+
+	void LevelXmlRowSink::OnEnd()
+	{
+		output << "</level>\n";
+	}
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "MazeRow.h"
+
+namespace mazer
+{
+	// Writes a maze as an XML level file as its rows arrive, keeping only the previous row's bottom walls
+	class LevelXmlRowSink final : public IMazeRowSink
+	{
+	public:
+		// A non-zero seed is saved with the level so that loading it reproduces everything random about it
+		explicit LevelXmlRowSink(std::ostream& output, bool autoPopulatePickups = true, std::uint64_t seed = 0);
+
+		void OnBegin(int rows, int columns) override;
+		void OnRow(const MazeRow& row) override;
+		void OnEnd() override;
+
+	private:
+		std::ostream& output;
+		bool autoPopulatePickups;
+		std::uint64_t seed;
+		std::vector<bool> topWalls;
+	};
+}
@@ -0,0 +1,82 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace mazer
+{
+#ifdef _WIN32
+	bool MappedFile::Open(const std::string& fileName)
+	{
+		Close();
+
+		file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE) { file = nullptr; return false; }
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) { Close(); return false; }
+
+		mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping == nullptr) { Close(); return false; }
+
+		data = static_cast<const std::uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+		if (data == nullptr) { Close(); return false; }
+
+		size = static_cast<std::size_t>(fileSize.QuadPart);
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (data != nullptr) { UnmapViewOfFile(data); }
+		if (mapping != nullptr) { CloseHandle(mapping); }
+		if (file != nullptr) { CloseHandle(file); }
+
+		data = nullptr;
+		mapping = nullptr;
+		file = nullptr;
+		size = 0;
+	}
+#else
+	bool MappedFile::Open(const std::string& fileName)
+	{
+		Close();
+
+		const auto descriptor = open(fileName.c_str(), O_RDONLY);
+		if (descriptor == -1) { return false; }
+
+		struct stat status {};
+		if (fstat(descriptor, &status) == -1 || status.st_size == 0)
+		{
+			close(descriptor);
+			return false;
+		}
+
+		// The mapping stays valid after the descriptor is closed
+		auto* mapped = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+		close(descriptor);
+		if (mapped == MAP_FAILED) { return false; }
+
+		data = static_cast<const std::uint8_t*>(mapped);
+		size = static_cast<std::size_t>(status.st_size);
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (data != nullptr) { munmap(const_cast<std::uint8_t*>(data), size); }
+
+		data = nullptr;
+		size = 0;
+	}
+#endif
+}
@@ -0,0 +1,43 @@
+#pragma once
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace mazer
+{
+	/**
+	 * \brief A read-only view of a whole file mapped into memory.
+	 *
+	 * Pages are loaded by the operating system as they are touched, so opening a file costs the same whatever its size.
+	 */
+	class MappedFile
+	{
+	public:
+		MappedFile() = default;
+		explicit MappedFile(const std::string& fileName) { Open(fileName); }
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+		~MappedFile() { Close(); }
+
+		// Returns false if the file does not exist, is empty or cannot be mapped
+		bool Open(const std::string& fileName);
+		void Close();
+
+		[[nodiscard]] bool IsOpen() const { return data != nullptr; }
+		[[nodiscard]] const std::uint8_t* GetData() const { return data; }
+		[[nodiscard]] std::size_t GetSize() const { return size; }
+
+	private:
+		const std::uint8_t* data = nullptr;
+		std::size_t size = 0;
+#ifdef _WIN32
+		void* file = nullptr;
+		void* mapping = nullptr;
+#endif
+	};
+}
+
+#endif
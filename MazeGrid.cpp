@@ -0,0 +1,90 @@
+#include "MazeGrid.h"
+#include <algorithm>
+
+using namespace gamelib;
+
+namespace mazer
+{
+	MazeGrid::MazeGrid(const int rows, const int columns, const bool walled)
+		: rows(rows), columns(columns)
+	{
+		horizontalStride = GetWordsPerRow(columns);
+		verticalStride = GetWordsPerRow(columns + 1);
+		horizontal.resize(static_cast<std::size_t>(rows + 1) * horizontalStride);
+		vertical.resize(static_cast<std::size_t>(rows) * verticalStride);
+
+		Fill(walled);
+	}
+
+	int MazeGrid::GetNeighborIndex(const int index, const Side side) const
+	{
+		const auto row = GetRow(index);
+		const auto column = GetColumn(index);
+
+		switch (side)
+		{
+		case Side::Top: return row > 0 ? index - columns : -1;
+		case Side::Right: return column < columns - 1 ? index + 1 : -1;
+		case Side::Bottom: return row < rows - 1 ? index + columns : -1;
+		case Side::Left: return column > 0 ? index - 1 : -1;
+		default: return -1;
+		}
+	}
+
+	bool MazeGrid::IsWalled(const int index, const Side side) const
+	{
+		const auto row = GetRow(index);
+		const auto column = GetColumn(index);
+
+		switch (side)
+		{
+		case Side::Top: return HasHorizontalWall(row, column);
+		case Side::Right: return HasVerticalWall(row, column + 1);
+		case Side::Bottom: return HasHorizontalWall(row + 1, column);
+		case Side::Left: return HasVerticalWall(row, column);
+		default: return false;
+		}
+	}
+
+	void MazeGrid::SetWall(const int index, const Side side, const bool walled)
+	{
+		const auto row = GetRow(index);
+		const auto column = GetColumn(index);
+
+		switch (side)
+		{
+		case Side::Top: SetHorizontalWall(row, column, walled); break;
+		case Side::Right: SetVerticalWall(row, column + 1, walled); break;
+		case Side::Bottom: SetHorizontalWall(row + 1, column, walled); break;
+		case Side::Left: SetVerticalWall(row, column, walled); break;
+		default: break;
+		}
+		version++;
+	}
+
+	void MazeGrid::Fill(const bool walled)
+	{
+		// Only the bits that represent real walls are set, the padding at the end of each row stays clear
+		auto fillPlane = [walled](std::vector<Word>& plane, const int planeRows, const int stride, const int bits)
+		{
+			for (auto row = 0; row < planeRows; row++)
+			{
+				for (auto word = 0; word < stride; word++)
+				{
+					const auto bitsInWord = std::min(WordBits, bits - word * WordBits);
+					const auto mask = bitsInWord == WordBits ? ~Word{ 0 } : (Word{ 1 } << bitsInWord) - 1;
+					plane[static_cast<std::size_t>(row) * stride + word] = walled ? mask : 0;
+				}
+			}
+		};
+
+		fillPlane(horizontal, rows + 1, horizontalStride, columns);
+		fillPlane(vertical, rows, verticalStride, columns + 1);
+		version++;
+	}
+
+	std::size_t MazeGrid::GetSizeInBytes() const
+	{
+		return sizeof(MazeGrid) + (horizontal.size() + vertical.size()) * sizeof(Word);
+	}
+}
@@ -0,0 +1,96 @@
+#pragma once
+#ifndef MAZEGRID_H
+#define MAZEGRID_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <cppgamelib/geometry/Side.h>
+
+namespace mazer
+{
+	/**
+	 * \brief Compact, bit-packed storage of the walls of a rows x columns maze.
+	 *
+	 * Walls are stored as shared edges: a wall between two rooms is one bit, not two. Horizontal walls (top/bottom)
+	 * live in one bit-plane of (rows + 1) x columns bits and vertical walls (left/right) in another of
+	 * rows x (columns + 1) bits. Each plane row is padded to a whole number of words so that regions of the grid
+	 * that are 64 columns apart never share a word.
+	 */
+	class MazeGrid
+	{
+	public:
+		using Word = std::uint64_t;
+		static constexpr int WordBits = 64;
+
+		MazeGrid(int rows, int columns, bool walled = true);
+
+		// Words needed to store a plane row of the given number of bits
+		static int GetWordsPerRow(const int bits) { return (bits + WordBits - 1) / WordBits; }
+
+		[[nodiscard]] int GetRows() const { return rows; }
+		[[nodiscard]] int GetColumns() const { return columns; }
+		[[nodiscard]] int GetRoomCount() const { return rows * columns; }
+		[[nodiscard]] int GetRow(const int index) const { return index / columns; }
+		[[nodiscard]] int GetColumn(const int index) const { return index % columns; }
+		[[nodiscard]] int GetIndex(const int row, const int column) const { return row * columns + column; }
+		[[nodiscard]] bool IsValidIndex(const int index) const { return index >= 0 && index < GetRoomCount(); }
+
+		// Index of the room on the given side of a room, or -1 if that side is the edge of the maze
+		[[nodiscard]] int GetNeighborIndex(int index, gamelib::Side side) const;
+
+		[[nodiscard]] bool IsWalled(int index, gamelib::Side side) const;
+		void SetWall(int index, gamelib::Side side, bool walled);
+		void AddWall(const int index, const gamelib::Side side) { SetWall(index, side, true); }
+		void RemoveWall(const int index, const gamelib::Side side) { SetWall(index, side, false); }
+		void Fill(bool walled);
+
+		// Edge addressing: horizontal wall above (row, column) where row is in [0, rows], and
+		// vertical wall to the left of (row, column) where column is in [0, columns]. The setters are raw writes
+		// that leave the version alone, so that generators can fill regions 64 columns apart from several threads.
+		// Whoever writes through them calls MarkChanged once done
+		[[nodiscard]] bool HasHorizontalWall(const int row, const int column) const { return GetBit(horizontal, horizontalStride, row, column); }
+		[[nodiscard]] bool HasVerticalWall(const int row, const int column) const { return GetBit(vertical, verticalStride, row, column); }
+		void SetHorizontalWall(const int row, const int column, const bool walled) { SetBit(horizontal, horizontalStride, row, column, walled); }
+		void SetVerticalWall(const int row, const int column, const bool walled) { SetBit(vertical, verticalStride, row, column, walled); }
+
+		// Raw bit-planes, for serialisation. Like the raw setters, writing to them needs a MarkChanged afterwards
+		[[nodiscard]] const std::vector<Word>& GetHorizontalWords() const { return horizontal; }
+		[[nodiscard]] const std::vector<Word>& GetVerticalWords() const { return vertical; }
+		[[nodiscard]] std::vector<Word>& GetHorizontalWords() { return horizontal; }
+		[[nodiscard]] std::vector<Word>& GetVerticalWords() { return vertical; }
+
+		// Changes whenever the walls change, through SetWall, Fill or MarkChanged, so that what is worked out from
+		// the walls can be kept until then
+		[[nodiscard]] std::uint32_t GetVersion() const { return version; }
+		void MarkChanged() { version++; }
+		[[nodiscard]] int GetHorizontalStride() const { return horizontalStride; }
+		[[nodiscard]] int GetVerticalStride() const { return verticalStride; }
+
+		// Number of bytes used to store the walls of the maze
+		[[nodiscard]] std::size_t GetSizeInBytes() const;
+
+	private:
+		static bool GetBit(const std::vector<Word>& plane, const int stride, const int row, const int column)
+		{
+			return (plane[static_cast<std::size_t>(row) * stride + column / WordBits] >> (column % WordBits)) & 1u;
+		}
+
+		static void SetBit(std::vector<Word>& plane, const int stride, const int row, const int column, const bool on)
+		{
+			auto& word = plane[static_cast<std::size_t>(row) * stride + column / WordBits];
+			const auto mask = Word{ 1 } << (column % WordBits);
+			word = on ? word | mask : word & ~mask;
+		}
+
+		int rows;
+		int columns;
+		int horizontalStride; // words per row of the horizontal plane
+		int verticalStride; // words per row of the vertical plane
+		std::vector<Word> horizontal;
+		std::vector<Word> vertical;
+		std::uint32_t version = 0;
+	};
+}
+
+#endif
@@ -0,0 +1,34 @@
+#include "MazeGridRowSink.h"
+#include "MazeGrid.h"
+
+namespace mazer
+{
+	MazeGridRowSink::MazeGridRowSink(MazeGrid& grid, const int firstRow, const int firstColumn)
+		: grid(grid), firstRow(firstRow), firstColumn(firstColumn), rows(0)
+	{
+	}
+
+	void MazeGridRowSink::OnBegin(const int rows, [[maybe_unused]] const int columns)
+	{
+		this->rows = rows;
+	}
+
+	void MazeGridRowSink::OnRow(const MazeRow& row)
+	{
+		// Only the walls inside the region are written: the walls on its border are either the outer walls of the
+		// grid or shared with a neighboring region, and belong to whoever joins the regions
+		const auto gridRow = firstRow + row.Row;
+
+		for (auto column = 0; column < row.GetColumns() - 1; column++)
+		{
+			grid.SetVerticalWall(gridRow, firstColumn + column + 1, row.HasRightWall(column));
+		}
+
+		if (row.Row == rows - 1) { return; }
+
+		for (auto column = 0; column < row.GetColumns(); column++)
+		{
+			grid.SetHorizontalWall(gridRow + 1, firstColumn + column, row.HasBottomWall(column));
+		}
+	}
+}
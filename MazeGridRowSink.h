@@ -0,0 +1,23 @@
+#pragma once
+#include "MazeRow.h"
+
+namespace mazer
+{
+	class MazeGrid;
+
+	// Writes the rows of a maze into a region of a MazeGrid, starting at the given row and column
+	class MazeGridRowSink final : public IMazeRowSink
+	{
+	public:
+		explicit MazeGridRowSink(MazeGrid& grid, int firstRow = 0, int firstColumn = 0);
+
+		void OnBegin(int rows, int columns) override;
+		void OnRow(const MazeRow& row) override;
+
+	private:
+		MazeGrid& grid;
+		int firstRow;
+		int firstColumn;
+		int rows;
+	};
+}
@@ -0,0 +1,11 @@
+#include "MazeRow.h"
+
+namespace mazer
+{
+	MazeRow::MazeRow(const int columns)
+		: columns(columns),
+		right((columns + MazeGrid::WordBits - 1) / MazeGrid::WordBits),
+		bottom((columns + MazeGrid::WordBits - 1) / MazeGrid::WordBits)
+	{
+	}
+}
@@ -0,0 +1,60 @@
+#pragma once
+#ifndef MAZEROW_H
+#define MAZEROW_H
+
+#include <vector>
+#include "MazeGrid.h"
+
+namespace mazer
+{
+	/**
+	 * \brief The walls of one row of a maze, as produced by a streaming maze generator.
+	 *
+	 * Each room in the row has a right wall (shared with the room to its right) and a bottom wall (shared with the
+	 * room below it). The top walls of a row are the bottom walls of the row above it, and the left wall of the
+	 * first room is always walled.
+	 */
+	class MazeRow
+	{
+	public:
+		explicit MazeRow(int columns);
+
+		[[nodiscard]] int GetColumns() const { return columns; }
+		[[nodiscard]] bool HasRightWall(const int column) const { return GetBit(right, column); }
+		[[nodiscard]] bool HasBottomWall(const int column) const { return GetBit(bottom, column); }
+		void SetRightWall(const int column, const bool walled) { SetBit(right, column, walled); }
+		void SetBottomWall(const int column, const bool walled) { SetBit(bottom, column, walled); }
+
+		// Row number of this row in the maze
+		int Row = 0;
+
+	private:
+		static bool GetBit(const std::vector<MazeGrid::Word>& bits, const int column)
+		{
+			return (bits[column / MazeGrid::WordBits] >> (column % MazeGrid::WordBits)) & 1u;
+		}
+
+		static void SetBit(std::vector<MazeGrid::Word>& bits, const int column, const bool on)
+		{
+			auto& word = bits[column / MazeGrid::WordBits];
+			const auto mask = MazeGrid::Word{ 1 } << (column % MazeGrid::WordBits);
+			word = on ? word | mask : word & ~mask;
+		}
+
+		int columns;
+		std::vector<MazeGrid::Word> right;
+		std::vector<MazeGrid::Word> bottom;
+	};
+
+	// Receives a maze one row at a time, top row first
+	class IMazeRowSink
+	{
+	public:
+		virtual ~IMazeRowSink() = default;
+		virtual void OnBegin([[maybe_unused]] int rows, [[maybe_unused]] int columns) {}
+		virtual void OnRow(const MazeRow& row) = 0;
+		virtual void OnEnd() {}
+	};
+}
+
+#endif
@@ -0,0 +1,129 @@
+#include "MazerSettings.h"
+#include <atomic>
+#include <charconv>
+#include <string>
+#include <cppgamelib/file/SettingsManager.h>
+
+using namespace gamelib;
+
+namespace mazer
+{
+	namespace
+	{
+#if defined(__cpp_lib_atomic_shared_ptr)
+		std::atomic<std::shared_ptr<const MazerSettings>> current;
+
+		std::shared_ptr<const MazerSettings> LoadCurrent() { return current.load(); }
+		void StoreCurrent(std::shared_ptr<const MazerSettings> settings) { current.store(std::move(settings)); }
+#else
+		std::shared_ptr<const MazerSettings> current;
+
+		std::shared_ptr<const MazerSettings> LoadCurrent() { return std::atomic_load(&current); }
+		void StoreCurrent(std::shared_ptr<const MazerSettings> settings) { std::atomic_store(&current, std::move(settings)); }
+#endif
+
+		// Bumped after the snapshot is stored, so whoever sees the new version gets at least the new snapshot
+		std::atomic<std::uint64_t> version{ 0 };
+
+		// Seeds are unsigned and 64-bit, which SettingsManager::Int can not hold. Anything else is no seed
+		std::uint64_t ParseSeed(const std::string& text)
+		{
+			std::uint64_t seed = 0;
+			const auto* end = text.data() + text.size();
+			if (const auto [last, error] = std::from_chars(text.data(), end, seed); error != std::errc() || last != end)
+			{
+				return 0;
+			}
+			return seed;
+		}
+	}
+
+	const MazerSettings CurrentSettings::Defaults{};
+
+	std::shared_ptr<const MazerSettings> MazerSettings::Read()
+	{
+		auto settings = std::make_shared<MazerSettings>();
+
+		auto& grid = settings->Grid;
+		grid.Rows = SettingsManager::Int("grid", "rows");
+		grid.Columns = SettingsManager::Int("grid", "cols");
+		grid.RemoveSidesRandomly = SettingsManager::Bool("grid", "removeSidesRandomly");
+		grid.NoWalls = SettingsManager::Bool("grid", "nowalls");
+		grid.Seed = ParseSeed(SettingsManager::String("grid", "seed"));
+		grid.TiledGeneration = SettingsManager::Bool("grid", "tiledGeneration");
+		grid.GeneratorThreads = SettingsManager::Int("grid", "generatorThreads");
+		grid.PerfectMaze = SettingsManager::Bool("grid", "perfectMaze");
+		grid.BraidPercent = SettingsManager::Int("grid", "braidPercent");
+
+		auto& room = settings->Room;
+		room.Fill = SettingsManager::Bool("room_fill", "enable");
+		room.InnerBoundsOffset = SettingsManager::Int("room", "innerBoundsOffset");
+		room.LogWallRemovals = SettingsManager::Bool("room", "logWallRemovals");
+		room.DrawInnerBounds = SettingsManager::Bool("room", "drawInnerBounds");
+		room.DrawHotSpot = SettingsManager::Bool("room", "drawHotSpot");
+		room.PrintDebuggingText = SettingsManager::Bool("global", "print_debugging_text");
+		room.PrintDebuggingTextNeighborsOnly = SettingsManager::Bool("global", "print_debugging_text_neighbours_only");
+
+		auto& enemy = settings->Enemy;
+		enemy.EmitMoveEvents = SettingsManager::Bool("enemy", "emitMoveEvents");
+		enemy.MoveAtSpeed = SettingsManager::Bool("enemy", "moveAtSpeed");
+		enemy.Speed = SettingsManager::Int("enemy", "speed");
+		enemy.MoveRateMs = SettingsManager::Int("enemy", "moveRateMs");
+		enemy.Animate = SettingsManager::Bool("enemy", "animate");
+		enemy.DrawState = SettingsManager::Bool("enemy", "drawState");
+		enemy.UseBehaviorTree = SettingsManager::Bool("enemy", "useBehaviorTree");
+		enemy.ChaseByFlowField = SettingsManager::Bool("enemy", "chaseByFlowField");
+
+		auto& player = settings->Player;
+		player.DrawBounds = SettingsManager::Bool("player", "drawBounds");
+		player.Verbose = SettingsManager::Bool("global", "verbose");
+		player.PixelsToMove = SettingsManager::Int("player", "pixelsToMove");
+		player.HotspotSize = SettingsManager::Int("player", "hotspotSize");
+		player.DrawHotSpot = SettingsManager::Bool("player", "drawHotspot");
+		player.HideSprite = SettingsManager::Bool("player", "hideSprite");
+		player.Speed = SettingsManager::Int("player", "speed");
+		player.DebugMovement = SettingsManager::Bool("player", "debugMovement");
+		player.IgnoreRestrictions = SettingsManager::Bool("player", "ignoreRestrictions");
+
+		return settings;
+	}
+
+	std::shared_ptr<const MazerSettings> MazerSettings::Get()
+	{
+		auto settings = LoadCurrent();
+		return settings != nullptr ? settings : Reload();
+	}
+
+	void MazerSettings::Set(std::shared_ptr<const MazerSettings> settings)
+	{
+		StoreCurrent(std::move(settings));
+		version.fetch_add(1, std::memory_order_release);
+	}
+
+	std::shared_ptr<const MazerSettings> MazerSettings::Reload()
+	{
+		auto settings = Read();
+		Set(settings);
+		return settings;
+	}
+
+	std::uint64_t MazerSettings::GetVersion()
+	{
+		return version.load(std::memory_order_acquire);
+	}
+
+	void CurrentSettings::Load()
+	{
+		// The version is read first: a reload in between only means the next refresh takes the snapshot again
+		version = MazerSettings::GetVersion();
+		settings = MazerSettings::Get();
+	}
+
+	bool CurrentSettings::Refresh()
+	{
+		if (settings == nullptr || version == MazerSettings::GetVersion()) { return false; }
+
+		Load();
+		return true;
+	}
+}
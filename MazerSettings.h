@@ -0,0 +1,116 @@
+#pragma once
+#ifndef MAZERSETTINGS_H
+#define MAZERSETTINGS_H
+
+#include <cstdint>
+#include <memory>
+
+namespace mazer
+{
+	struct GridSettings
+	{
+		int Rows = 0;
+		int Columns = 0;
+		bool RemoveSidesRandomly = false;
+		bool NoWalls = false;
+		std::uint64_t Seed = 0; // 0 for a new level every time
+		bool TiledGeneration = false;
+		int GeneratorThreads = 0;
+		bool PerfectMaze = false;
+		int BraidPercent = 0;
+	};
+
+	struct RoomSettings
+	{
+		bool Fill = false;
+		int InnerBoundsOffset = 0;
+		bool LogWallRemovals = false;
+		bool DrawInnerBounds = false;
+		bool DrawHotSpot = false;
+		bool PrintDebuggingText = false; // global
+		bool PrintDebuggingTextNeighborsOnly = false; // global
+	};
+
+	struct EnemySettings
+	{
+		bool EmitMoveEvents = false;
+		bool MoveAtSpeed = false;
+		int Speed = 0;
+		int MoveRateMs = 0;
+		bool Animate = false;
+		bool DrawState = false;
+		bool UseBehaviorTree = false;
+		bool ChaseByFlowField = false;
+	};
+
+	struct PlayerSettings
+	{
+		bool DrawBounds = false;
+		bool Verbose = false; // global
+		int PixelsToMove = 0;
+		int HotspotSize = 0;
+		bool DrawHotSpot = false;
+		bool HideSprite = false;
+		int Speed = 0;
+		bool DebugMovement = false;
+		bool IgnoreRestrictions = false;
+	};
+
+	/**
+	 * \brief Typed, immutable snapshot of the settings mazer uses.
+	 *
+	 * Built once from the SettingsManager when first needed and again on each reload, so game objects read plain
+	 * fields instead of looking settings up by name. A reload swaps the current snapshot atomically and nothing else:
+	 * readers holding the previous one keep a consistent copy, and objects holding CurrentSettings pick up the new one
+	 * the next time they refresh.
+	 */
+	class MazerSettings
+	{
+	public:
+		GridSettings Grid;
+		RoomSettings Room;
+		EnemySettings Enemy;
+		PlayerSettings Player;
+
+		// Reads a new snapshot from the SettingsManager
+		static std::shared_ptr<const MazerSettings> Read();
+
+		// The current snapshot
+		static std::shared_ptr<const MazerSettings> Get();
+
+		// Makes the snapshot current, e.g. to test with specific settings
+		static void Set(std::shared_ptr<const MazerSettings> settings);
+
+		// Reads the settings again and makes them current
+		static std::shared_ptr<const MazerSettings> Reload();
+
+		// Changes each time a snapshot is made current
+		static std::uint64_t GetVersion();
+	};
+
+	/**
+	 * \brief An object's hold on the current settings snapshot.
+	 *
+	 * Reading a setting through it is a pointer dereference. Refresh checks for a reload with one atomic load, so
+	 * objects can call it every update rather than be told about reloads. Until Load is called it reads the defaults.
+	 */
+	class CurrentSettings
+	{
+	public:
+		// Takes the current snapshot
+		void Load();
+
+		// Takes the current snapshot if settings were loaded and have been reloaded since, true if it did
+		bool Refresh();
+
+		const MazerSettings* operator->() const { return settings != nullptr ? settings.get() : &Defaults; }
+
+	private:
+		static const MazerSettings Defaults;
+
+		std::shared_ptr<const MazerSettings> settings;
+		std::uint64_t version = 0;
+	};
+}
+
+#endif
@@ -0,0 +1,188 @@
+#include "PathFinder.h"
+#include <algorithm>
+#include <cstdlib>
+
+#include "MazeGrid.h"
+
+using namespace gamelib;
+
+namespace mazer
+{
+	namespace
+	{
+		constexpr Side Sides[] = { Side::Top, Side::Right, Side::Bottom, Side::Left };
+
+		Side GetOppositeSide(const Side side)
+		{
+			switch (side)
+			{
+			case Side::Top: return Side::Bottom;
+			case Side::Right: return Side::Left;
+			case Side::Bottom: return Side::Top;
+			case Side::Left: return Side::Right;
+			default: return side;
+			}
+		}
+	}
+
+	PathFinder::PathFinder(std::shared_ptr<const MazeGrid> grid, const Search search)
+		: grid(std::move(grid)), search(search)
+	{
+		const auto rooms = static_cast<std::size_t>(this->grid->GetRoomCount());
+		reached.assign(rooms, 0);
+		closed.assign(rooms, 0);
+		costs.resize(rooms);
+		parents.resize(rooms);
+		vias.resize(rooms);
+		openList.reserve(rooms);
+		jumpPoints.reserve(rooms);
+	}
+
+	bool PathFinder::FindPath(const int from, const int to, std::vector<int>& path)
+	{
+		path.clear();
+		expanded = 0;
+
+		if (!grid->IsValidIndex(from) || !grid->IsValidIndex(to)) { return false; }
+
+		// A new search number makes the state of every previous search stale, without touching it
+		if (++searchNumber == 0)
+		{
+			std::fill(reached.begin(), reached.end(), 0);
+			std::fill(closed.begin(), closed.end(), 0);
+			searchNumber = 1;
+		}
+
+		openList.clear();
+		Open(from, 0, -1, Side::None, to);
+
+		while (!openList.empty())
+		{
+			std::pop_heap(openList.begin(), openList.end(), IsWorse);
+			const auto room = openList.back().Room;
+			openList.pop_back();
+
+			// Rooms can be on the open list more than once, the cheapest is expanded first
+			if (closed[room] == searchNumber) { continue; }
+			closed[room] = searchNumber;
+			expanded++;
+
+			if (room == to)
+			{
+				BuildPath(from, to, path);
+				return true;
+			}
+
+			for (const auto side : Sides)
+			{
+				if (grid->IsWalled(room, side) || grid->GetNeighborIndex(room, side) < 0) { continue; }
+
+				auto steps = 1;
+				const auto next = search == Search::JumpPoint
+					? Jump(room, side, to, steps)
+					: grid->GetNeighborIndex(room, side);
+
+				if (next < 0 || closed[next] == searchNumber) { continue; }
+
+				const auto cost = costs[room] + steps;
+				if (reached[next] == searchNumber && costs[next] <= cost) { continue; }
+
+				Open(next, cost, room, side, to);
+			}
+		}
+
+		return false;
+	}
+
+	int PathFinder::Estimate(const int room, const int goal) const
+	{
+		return std::abs(grid->GetRow(room) - grid->GetRow(goal)) +
+			std::abs(grid->GetColumn(room) - grid->GetColumn(goal));
+	}
+
+	void PathFinder::Open(const int room, const int cost, const int parent, const Side via, const int goal)
+	{
+		reached[room] = searchNumber;
+		costs[room] = cost;
+		parents[room] = parent;
+		vias[room] = via;
+
+		const auto estimate = Estimate(room, goal);
+		openList.push_back({ cost + estimate, estimate, room });
+		std::push_heap(openList.begin(), openList.end(), IsWorse);
+	}
+
+	int PathFinder::Jump(const int room, Side side, const int goal, int& steps) const
+	{
+		steps = 0;
+		auto current = room;
+
+		while (true)
+		{
+			current = grid->GetNeighborIndex(current, side);
+			steps++;
+
+			// Stop at the goal, and back where we started if the corridor is a loop
+			if (current == goal || current == room) { return current; }
+
+			Side exit;
+			if (GetOnlyExit(current, GetOppositeSide(side), exit))
+			{
+				side = exit;
+				continue;
+			}
+
+			// A junction, unless there is no way on at all: nothing past a dead end can be on a shortest path
+			for (const auto other : Sides)
+			{
+				if (other != GetOppositeSide(side) && !grid->IsWalled(current, other) &&
+					grid->GetNeighborIndex(current, other) >= 0)
+				{
+					return current;
+				}
+			}
+			return -1;
+		}
+	}
+
+	bool PathFinder::GetOnlyExit(const int room, const Side entered, Side& exit) const
+	{
+		auto exits = 0;
+		for (const auto side : Sides)
+		{
+			if (side != entered && !grid->IsWalled(room, side) && grid->GetNeighborIndex(room, side) >= 0)
+			{
+				exit = side;
+				exits++;
+			}
+		}
+		return exits == 1;
+	}
+
+	void PathFinder::BuildPath(const int from, const int to, std::vector<int>& path)
+	{
+		// The parents lead back from the goal through the rooms that were expanded
+		jumpPoints.clear();
+		for (auto room = to; room != from; room = parents[room])
+		{
+			jumpPoints.push_back(room);
+		}
+
+		// Walk forwards between them, filling in the corridors that were jumped over
+		path.push_back(from);
+		for (auto i = jumpPoints.size(); i-- > 0;)
+		{
+			const auto target = jumpPoints[i];
+			auto side = vias[target];
+			auto current = path.back();
+
+			while (true)
+			{
+				current = grid->GetNeighborIndex(current, side);
+				path.push_back(current);
+				if (current == target) { break; }
+				GetOnlyExit(current, GetOppositeSide(side), side);
+			}
+		}
+	}
+}
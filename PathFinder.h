@@ -0,0 +1,79 @@
+#pragma once
+#ifndef PATHFINDER_H
+#define PATHFINDER_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <cppgamelib/geometry/Side.h>
+
+namespace mazer
+{
+	class MazeGrid;
+
+	/**
+	 * \brief Shortest paths between rooms of a maze, through the walls that are open.
+	 *
+	 * A* with a Manhattan heuristic. The jump point variant uses the uniform grid to skip along corridors: it only
+	 * stops at junctions and the goal, and never steps into dead ends, so far fewer rooms are put on the open list.
+	 * Both find paths of the same length.
+	 *
+	 * The open list and the per-room search state are sized to the grid once and reused by every query, and
+	 * marked stale by bumping a search number rather than cleared, so queries do not allocate once warm.
+	 * A path finder is not safe to use from more than one thread at a time.
+	 */
+	class PathFinder
+	{
+	public:
+		enum class Search { AStar, JumpPoint };
+
+		explicit PathFinder(std::shared_ptr<const MazeGrid> grid, Search search = Search::AStar);
+
+		// Fills the path with the rooms from one room to the other, both included. False, with an empty path, if
+		// there is no way through
+		bool FindPath(int from, int to, std::vector<int>& path);
+
+		[[nodiscard]] Search GetSearch() const { return search; }
+
+		// Rooms taken off the open list by the last query
+		[[nodiscard]] int GetExpanded() const { return expanded; }
+
+	private:
+		struct OpenNode
+		{
+			int F; // cost so far plus estimate
+			int H; // estimate, to prefer nodes nearer the goal when F ties
+			int Room;
+		};
+
+		// Orders the open list as a min heap on F then H
+		static bool IsWorse(const OpenNode& a, const OpenNode& b) { return a.F != b.F ? a.F > b.F : a.H > b.H; }
+
+		[[nodiscard]] int Estimate(int room, int goal) const;
+		void Open(int room, int cost, int parent, gamelib::Side via, int goal);
+
+		// Follows the corridor leaving a room through a side, until it reaches the goal or a junction. Returns the
+		// room reached and the steps taken, or -1 at a dead end
+		int Jump(int room, gamelib::Side side, int goal, int& steps) const;
+
+		// Whether a room has exactly one way out other than back through the given side, and which
+		bool GetOnlyExit(int room, gamelib::Side entered, gamelib::Side& exit) const;
+
+		void BuildPath(int from, int to, std::vector<int>& path);
+
+		std::shared_ptr<const MazeGrid> grid;
+		Search search;
+		int expanded = 0;
+
+		std::uint32_t searchNumber = 0;
+		std::vector<std::uint32_t> reached; // search number in which a room was last given a cost
+		std::vector<std::uint32_t> closed; // search number in which a room was last expanded
+		std::vector<int> costs;
+		std::vector<int> parents;
+		std::vector<gamelib::Side> vias; // the side of the parent the room was reached through
+		std::vector<OpenNode> openList;
+		std::vector<int> jumpPoints;
+	};
+}
+
+#endif
@@ -1,8 +1,10 @@
 #include "Player.h"
+#include <algorithm>
+#include <bit>
 #include <memory>
 #include <cppgamelib/events/EventFactory.h>
 #include <cppgamelib/events/EventManager.h>
-#include <cppgamelib/file/SettingsManager.h>
+#include "MazerSettings.h"
 
 #include "EventNumber.h"
 //#include "GameData.h"
@@ -12,8 +14,12 @@
 #include <character/AnimatedSprite.h>
 #include <character/Hotspot.h>
 //#include "GameObjectMoveStrategy.h"
-//#include "GameObjectMoveStrategy.h"
+#include "Enemy.h"
 #include "GameData.h"
+#include "GameObjectMoveStrategy.h"
+#include "pickup.h"
+#include "PooledEvents.h"
+#include "SDLCollisionDetection.h"
 #include "character/IGameMoveStrategy.h"
 #include <cppgamelib/character/StatefulMove.h>
 
@@ -27,9 +33,9 @@ namespace mazer
 		const Coordinate<int> position, // we know the position the player is at
 		const int width,
 		const int height,
-		const std::string& identifier)
+		const std::string& identifier, World& world)
 		: DrawableGameObject(name, type, position, true), CurrentMovingDirection(Direction::Down),
-		CurrentFacingDirection(Direction::Down)
+		CurrentFacingDirection(Direction::Down), world(&world)
 	{
 		CommonInit(width, height, identifier);
 	}
@@ -38,34 +44,34 @@ namespace mazer
 		const std::shared_ptr<Room>& playerRoom, // we know the room the player will be in
 		const int playerWidth,
 		const int playerHeight,
-		const std::string& identifier)
+		const std::string& identifier, World& world)
 		: DrawableGameObject(name, type, playerRoom->GetCenter(playerWidth, playerHeight), true),
-		CurrentMovingDirection(Direction::Down), CurrentFacingDirection(Direction::Down)
+		CurrentMovingDirection(Direction::Down), CurrentFacingDirection(Direction::Down), world(&world)
 	{
 		CommonInit(playerWidth, playerHeight, identifier);
-		CurrentRoom = make_shared<RoomInfo>(playerRoom);
+		CurrentRoom = make_shared<RoomInfo>(playerRoom, world);
 		CenterPlayerInRoom(playerRoom);
 	}
 
 	Player::Player(const std::string& name, const std::string& type, const std::shared_ptr<Room>& playerRoom,
-		const AbcdRectangle& dimensions, const std::string& identifier)
+		const AbcdRectangle& dimensions, const std::string& identifier, World& world)
 		: DrawableGameObject(name, type, playerRoom->GetCenter(dimensions.GetWidth(), dimensions.GetHeight()), true),
-		CurrentMovingDirection(Direction::Down), CurrentFacingDirection(Direction::Down)
+		CurrentMovingDirection(Direction::Down), CurrentFacingDirection(Direction::Down), world(&world)
 	{
 		CommonInit(dimensions.GetWidth(), dimensions.GetWidth(), identifier);
-		CurrentRoom = make_shared<RoomInfo>(playerRoom);
+		CurrentRoom = make_shared<RoomInfo>(playerRoom, world);
 		CenterPlayerInRoom(playerRoom);
 	}
 
 	Player::Player(const std::string& name,
 		const std::string& type,
 		const std::shared_ptr<Room>& playerRoom,
-		const std::string& identifier)
+		const std::string& identifier, World& world)
 		: DrawableGameObject(name, type, playerRoom->GetCenter(0, 0), true),
-		CurrentMovingDirection(Direction::Down), CurrentFacingDirection(Direction::Down)
+		CurrentMovingDirection(Direction::Down), CurrentFacingDirection(Direction::Down), world(&world)
 	{
 		CommonInit(0, 0, identifier); // Height / Width set by setting the asset
-		CurrentRoom = make_shared<RoomInfo>(playerRoom);
+		CurrentRoom = make_shared<RoomInfo>(playerRoom, world);
 		CenterPlayerInRoom(playerRoom);
 	}
 
@@ -89,7 +95,6 @@ namespace mazer
 		UpdateBounds(Width, Height);
 
 		SubscribeToEvent(ControllerMoveEventId); // player wants to know when the controller moves
-		SubscribeToEvent(SettingsReloadedEventId); // wants to know when settings are reloaded
 		SubscribeToEvent(FireEventId); // wants to know when the fire button is pressed
 		SubscribeToEvent(GameWonEventId); // want to know when the game is won
 	}
@@ -98,16 +103,8 @@ namespace mazer
 	{
 		GameObject::LoadSettings();
 
-		drawBounds = SettingsManager::Get()->GetBool("player", "drawBounds");
-		verbose = SettingsManager::Get()->GetBool("global", "verbose");
-		pixelsToMove = SettingsManager::Get()->GetInt("player", "pixelsToMove");
-		hotspotSize = SettingsManager::Get()->GetInt("player", "hotspotSize");
-		drawHotSpot = SettingsManager::Get()->GetBool("player", "drawHotspot");
-		hideSprite = SettingsManager::Get()->GetBool("player", "hideSprite");
-		speed = SettingsManager::Get()->Int("player", "speed");
-		moveRateMs = SettingsManager::Int("enemy", "moveRateMs");
-
-		moveTimer.SetFrequency(moveRateMs);
+		settings.Load();
+		moveTimer.SetFrequency(settings->Enemy.MoveRateMs);
 	}
 
 	void Player::LogMessage(const char* str, bool verbose)
@@ -128,14 +125,9 @@ namespace mazer
 			Fire();
 		}
 
-		if (event->Id.PrimaryId == SettingsReloadedEventId.PrimaryId)
-		{
-			LoadSettings();
-		}
-
 		if (event->Id.PrimaryId == InvalidMoveEventId.PrimaryId)
 		{
-			LogMessage("Invalid move", verbose);
+			LogMessage("Invalid move", settings->Player.Verbose);
 		}
 
 		if (event->Id.PrimaryId == GameWonEventId.PrimaryId)
@@ -153,68 +145,97 @@ namespace mazer
 			return createdEvents;
 		}
 
-		const auto moveEvent = dynamic_pointer_cast<ControllerMoveEvent>(event);
-		const auto moveDirection = moveEvent->direction;
+		// The id has been checked, so the event is a controller move event without asking RTTI
+		auto& moveEvent = static_cast<ControllerMoveEvent&>(*event);
+		SetDirectionKeyState(moveEvent.direction, moveEvent.GetKeyState());
 
+		return createdEvents;
+	}
+
+	void Player::SetDirectionKeyState(const Direction direction, const ControllerMoveEvent::KeyState keyState)
+	{
 		// Set acceleration in direction depending on if direction key is pressed or not
-		DirectionKeyStates[moveDirection] = moveEvent->GetKeyState();
+		DirectionKeyStates[direction] = keyState;
 
-		SetPlayerDirection(moveDirection);
+		const auto key = GameObjectMoveStrategy::GetMovePermission(direction);
+		pressedDirectionKeys = keyState == ControllerMoveEvent::KeyState::Pressed
+			? static_cast<std::uint8_t>(pressedDirectionKeys | key)
+			: static_cast<std::uint8_t>(pressedDirectionKeys & ~key);
 
-		return createdEvents;
+		SetPlayerDirection(direction);
 	}
 
 	void Player::Update(const unsigned long deltaMs)
 	{
-		if (GameData::Get()->IsGameWon()) return;
+		if (world->Data().IsGameWon()) return;
+
+		// Settings are read where they are used, only the move timer needs telling about a reload
+		if (settings.Refresh()) { moveTimer.SetFrequency(settings->Enemy.MoveRateMs); }
 
 		moveTimer.Update(deltaMs);
 
 		// We don't move every single frame...
 		moveTimer.DoIfReady([&]()
 			{
-				const auto keyStateBackup = DirectionKeyStates;
-
-				CancelInvalidDirectionKeyPresses(DirectionKeyStates);
+				const auto cancelledKeys = CancelInvalidDirectionKeyPresses();
 
 				Move(deltaMs);
 
 				// restore original key states (e.g. the temporarily cancelled keypress my now be acceptable)
-				DirectionKeyStates = keyStateBackup;
+				RestoreDirectionKeyPresses(cancelledKeys);
 			});
 	}
 
-	void Player::CancelInvalidDirectionKeyPresses(std::map<Direction, ControllerMoveEvent::KeyState>& currentKeyStates)
+	std::uint8_t Player::CancelInvalidDirectionKeyPresses()
 	{
-		// If there are any directions that are invalid, temporarily cancel the direction's keypress
-		for (const auto& [direction, keyState] : currentKeyStates)
+		// If there are any directions that are invalid, temporarily cancel the direction's keypress. Only the pressed
+		// keys are looked at, and the key states are changed in place rather than copied and restored
+		std::uint8_t cancelledKeys = 0;
+		for (const auto direction : { Direction::Up, Direction::Down, Direction::Left, Direction::Right })
 		{
-			if (keyState == ControllerMoveEvent::KeyState::Pressed && !moveStrategy->CanGameObjectMove(direction))
+			const auto key = GameObjectMoveStrategy::GetMovePermission(direction);
+			if ((pressedDirectionKeys & key) != 0 && !moveStrategy->CanGameObjectMove(direction))
 			{
 				DirectionKeyStates[direction] = ControllerMoveEvent::KeyState::Released;
+				cancelledKeys |= key;
+			}
+		}
+		return cancelledKeys;
+	}
+
+	void Player::RestoreDirectionKeyPresses(const std::uint8_t cancelledKeys)
+	{
+		if (cancelledKeys == 0) { return; }
+
+		for (const auto direction : { Direction::Up, Direction::Down, Direction::Left, Direction::Right })
+		{
+			if ((cancelledKeys & GameObjectMoveStrategy::GetMovePermission(direction)) != 0)
+			{
+				DirectionKeyStates[direction] = ControllerMoveEvent::KeyState::Pressed;
 			}
 		}
 	}
 
 	void Player::Move(const unsigned long deltaMs)
 	{
-		const auto movement = std::make_shared<StatefulMove>(speed, DirectionKeyStates, deltaMs);
+		// The movement reads the key states where they are, and lives on the stack for this move only
+		StatefulMove movement(settings->Player.Speed, DirectionKeyStates, deltaMs);
 
 		// Move player
-		const auto isValidMove = moveStrategy->MoveGameObject(movement);
+		const auto isValidMove = GameObjectMoveStrategy::MoveGameObject(*moveStrategy, movement);
 
 		if (!isValidMove)
 		{
-			EventManager::Get()->RaiseEvent(EventFactory::Get()->CreateGenericEvent(InvalidMoveEventId, GetName()), this);
+			world->Events().RaiseEvent(EventFactory::Get()->CreateGenericEvent(InvalidMoveEventId, GetName()), this);
 		}
 
 		// Move player's sprite also
 		if (Sprite)
 		{
 			// Only animate sprite if there is no direction set
-			if (movement->GetDirection() != Direction::None)
+			if (movement.GetDirection() != Direction::None)
 			{
-				Sprite->Update(deltaMs, AnimatedSprite::GetStdDirectionAnimationFrameGroup(movement->GetDirection()));
+				Sprite->Update(deltaMs, AnimatedSprite::GetStdDirectionAnimationFrameGroup(movement.GetDirection()));
 			}
 
 			Sprite->MoveSprite(Position.GetX(), Position.GetY());
@@ -224,21 +245,85 @@ namespace mazer
 
 		UpdateBounds(Width, Height);
 
+		// The room the player is in follows from where its hotspot is, there is no need to ask every room
+		const auto hotspot = Hotspot->GetBounds();
+		if (CurrentRoom->UpdateCurrentRoom(hotspot.x + hotspot.w / 2, hotspot.y + hotspot.h / 2))
+		{
+			// Enemies chase along the flow field, which is rooted at the player's room
+			world->Data().GetFlowField().SetTarget(CurrentRoom->TheRoom->GetGrid(), CurrentRoom->RoomIndex);
+		}
+
 		// Only register a move if there was a move in a known direction
-		if (movement->GetDirection() != Direction::None)
+		if (movement.GetDirection() != Direction::None)
+		{
+			world->Events().RaiseEvent(world->Pools().MakePlayerMovedEvent(movement.GetDirection()), this);
+			CheckForCollisions();
+		}
+	}
+
+	void Player::CheckForCollisions()
+	{
+		auto& gameData = world->Data();
+		if (gameData.GetPlayer(gameData.GetPlayerHandle()) != this) { return; }
+
+		// Only what is in the rooms the player overlaps can be touching it. What is touched is collected first, as
+		// the events raised for it remove it from the game data
+		nearbyPickups.clear();
+		nearbyPickupBounds.Clear();
+		touchedPickups.clear();
+		touchedEnemies.clear();
+		gameData.GetRoomLocator().ForEachRoomOverlapping(Bounds.x, Bounds.y, Bounds.w, Bounds.h, [&](const int room)
+			{
+				// Rooms can hold many pickups, so their bounds are gathered and tested in batches
+				for (const auto handle : gameData.GetPickupsInRoom(room))
+				{
+					if (auto* pickup = gameData.GetPickup(handle); pickup != nullptr)
+					{
+						nearbyPickups.push_back(pickup);
+						nearbyPickupBounds.Add(pickup->Bounds);
+					}
+				}
+
+				// Enemies in an enemy system are checked by the system
+				for (const auto handle : gameData.GetEnemiesInRoom(room))
+				{
+					if (auto* enemy = gameData.GetEnemy(handle); enemy != nullptr && enemy->GetEnemySystem() == nullptr &&
+						SdlCollisionDetection::IsColliding(&Bounds, &enemy->Bounds))
+					{
+						touchedEnemies.push_back(enemy);
+					}
+				}
+			});
+
+		const auto pickupBounds = nearbyPickupBounds.GetColumns();
+		for (std::size_t first = 0; first < nearbyPickups.size(); first += BatchCollisionDetection::MaxBatch)
+		{
+			const auto count = std::min(nearbyPickups.size() - first, BatchCollisionDetection::MaxBatch);
+			for (auto hits = BatchCollisionDetection::Overlaps(Bounds, pickupBounds, first, count); hits != 0;
+				hits &= hits - 1)
+			{
+				touchedPickups.push_back(nearbyPickups[first + static_cast<std::size_t>(std::countr_zero(hits))]);
+			}
+		}
+
+		if (touchedPickups.empty() && touchedEnemies.empty()) { return; }
+
+		const auto self = gameData.GetPlayer();
+		for (auto* pickup : touchedPickups)
 		{
-			EventManager::Get()->RaiseEvent(EventFactory::Get()->CreatePlayerMovedEvent(movement->GetDirection()), this);
+			for (const auto& event : pickup->CollideWithPlayer(self)) { world->Events().RaiseEvent(event, pickup); }
 		}
+		for (auto* enemy : touchedEnemies) { enemy->CollideWithPlayer(self); }
 	}
 
 	void Player::Draw(SDL_Renderer* renderer)
 	{
 		// Draw
-		if (!hideSprite) { Sprite->Draw(renderer); }
-		if (drawHotSpot) { Hotspot->Draw(renderer); }
+		if (!settings->Player.HideSprite) { Sprite->Draw(renderer); }
+		if (settings->Player.DrawHotSpot) { Hotspot->Draw(renderer); }
 
 		// Debugging
-		if (drawBounds)
+		if (settings->Player.DrawBounds)
 		{
 			constexpr SDL_Color colour = { 255, 0, 0, 0 };
 			SDL_SetRenderDrawColor(renderer, colour.r, colour.g, colour.b, colour.a);
@@ -283,7 +368,7 @@ namespace mazer
 		Width = inSprite->Dimensions.GetWidth();
 		Height = inSprite->Dimensions.GetHeight();
 
-		Hotspot = std::make_shared<gamelib::Hotspot>(Position, Width, Height, hotspotSize);
+		Hotspot = std::make_shared<gamelib::Hotspot>(Position, Width, Height, settings->Player.HotspotSize);
 
 		CalculateBounds(Position, Width, Height);
 	}
@@ -295,7 +380,7 @@ namespace mazer
 
 	inline int Player::GetHotSpotLength() const
 	{
-		return hotspotSize;
+		return settings->Player.HotspotSize;
 	}
 
 	int Player::GetWidth() const
@@ -1,11 +1,17 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <cppgamelib/events/ControllerMoveEvent.h>
 #include <objects/DrawableGameObject.h>
 #include <time/PeriodicTimer.h>
 
+#include "BatchCollisionDetection.h"
+#include "MazerSettings.h"
+#include "SlotMap.h"
+#include "World.h"
+
 
 
 namespace gamelib
@@ -20,6 +26,8 @@ namespace gamelib
 namespace mazer
 {
 
+	class Enemy;
+	class Pickup;
 	class RoomInfo;
 	class Room;
 
@@ -32,17 +40,17 @@ namespace mazer
 	public:
 		Player(const std::string& name, const std::string& type, gamelib::Coordinate<int> position, int width,
 			int height, const std::string
-			& identifier);
+			& identifier, World& world = World::Default());
 
 		Player(const std::string& name, const std::string& type, const std::shared_ptr<Room>& playerRoom, int playerWidth,
 			int playerHeight,
-			const std::string& identifier);
+			const std::string& identifier, World& world = World::Default());
 
 		Player(const std::string& name, const std::string& type, const std::shared_ptr<Room>& playerRoom, const gamelib::AbcdRectangle& dimensions,
-			const std::string& identifier);
+			const std::string& identifier, World& world = World::Default());
 
 		Player(const std::string& name, const std::string& type, const std::shared_ptr<Room>& playerRoom,
-			const std::string& identifier);
+			const std::string& identifier, World& world = World::Default());
 
 		void LoadSettings() override;
 		void LogMessage(const char* str, bool verbose);
@@ -57,6 +65,9 @@ namespace mazer
 		void RemoveBottomWall() const;
 		void RemoveTopWall() const;
 		void SetPlayerDirection(gamelib::Direction direction);
+
+		// Presses or releases a direction key, as a controller move event does
+		void SetDirectionKeyState(gamelib::Direction direction, gamelib::ControllerMoveEvent::KeyState keyState);
 		void Update(unsigned long deltaMs) override;
 		void Draw(SDL_Renderer* renderer) override;
 
@@ -70,10 +81,12 @@ namespace mazer
 		gamelib::GameObjectType GetGameObjectType() override { return gamelib::GameObjectType::game_defined; }
 		int GetHealth();
 		int GetPoints();
+		[[nodiscard]] World& GetWorld() const { return *world; }
 
 		std::shared_ptr<RoomInfo> CurrentRoom;
 		std::string Identifier;
 		std::shared_ptr<gamelib::Hotspot> Hotspot;
+		SlotHandle Handle; // in the game data, while registered
 
 	private:
 		void CommonInit(int playerWidth, int playerHeight, const std::string& identifier);
@@ -81,23 +94,24 @@ namespace mazer
 		const gamelib::ListOfEvents& OnControllerMove(const std::shared_ptr<gamelib::Event>& event,
 			gamelib::ListOfEvents& createdEvents, unsigned long deltaMs);
 		void Move(unsigned long deltaMs);
-		void CancelInvalidDirectionKeyPresses(std::map<gamelib::Direction, gamelib::ControllerMoveEvent::KeyState>& currentKeyStates);
-		int speed{};
-		int pixelsToMove = 0;
+		void CheckForCollisions(); // with the pickups and enemies in the rooms the player overlaps
+		std::uint8_t CancelInvalidDirectionKeyPresses(); // returns the keys released, to be pressed again after the move
+		void RestoreDirectionKeyPresses(std::uint8_t cancelledKeys);
 		std::shared_ptr<gamelib::AnimatedSprite> Sprite;
 		int Width{};
 		int Height{};
-		bool drawBounds = false;
-		bool hideSprite = false;
-		bool drawHotSpot = false;
-		int hotspotSize = 0;
 		gamelib::Direction CurrentMovingDirection;
 		gamelib::Direction CurrentFacingDirection;
+		World* world;
 		std::shared_ptr<gamelib::IGameObjectMoveStrategy> moveStrategy;
-		bool verbose{};
 		bool gameWon = false;
+		CurrentSettings settings;
 		gamelib::PeriodicTimer moveTimer;
-		int moveRateMs{};
 		std::map<gamelib::Direction, gamelib::ControllerMoveEvent::KeyState> DirectionKeyStates{};
+		std::uint8_t pressedDirectionKeys = 0; // one GameObjectMoveStrategy::MovePermission bit per pressed key
+		std::vector<Pickup*> nearbyPickups; // reused from move to move, as are their bounds
+		BoundsBatch nearbyPickupBounds;
+		std::vector<Pickup*> touchedPickups;
+		std::vector<Enemy*> touchedEnemies;
 	};
 }
\ No newline at end of file
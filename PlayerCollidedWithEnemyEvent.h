@@ -4,17 +4,30 @@
 
 namespace mazer
 {
+	class Enemy;
+	class Player;
 
 	const gamelib::EventId PlayerCollidedWithEnemyEventId(CollidedWithEnemy, "CollidedWithEnemyEvent");
 
 	class PlayerCollidedWithEnemyEvent final : public gamelib::Event
 	{
 	public:
+		static constexpr int Number = CollidedWithEnemy;
+
+		PlayerCollidedWithEnemyEvent() : Event(PlayerCollidedWithEnemyEventId) {}
+
 		explicit PlayerCollidedWithEnemyEvent(std::shared_ptr<Enemy> enemy, std::shared_ptr<Player> other)
 			: Event(PlayerCollidedWithEnemyEventId), TheEnemy(std::move(enemy)), ThePlayer(std::move(other))
 		{
 		}
 
+		// Lets go of the enemy and player once delivered, when pooled
+		void Clear()
+		{
+			TheEnemy.reset();
+			ThePlayer.reset();
+		}
+
 		std::shared_ptr<Enemy> TheEnemy;
 		std::shared_ptr<Player> ThePlayer;
 	};
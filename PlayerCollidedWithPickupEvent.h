@@ -6,16 +6,30 @@
 
 namespace mazer
 {
+	class Pickup;
+	class Player;
+
 	const gamelib::EventId PlayerCollidedWithPickupEventId(PlayerCollidedWithPickup, "CollidedWithEnemyEvent");
 
 	class PlayerCollidedWithPickupEvent final : public gamelib::Event
 	{
 	public:
+		static constexpr int Number = PlayerCollidedWithPickup;
+
+		PlayerCollidedWithPickupEvent() : Event(PlayerCollidedWithPickupEventId) {}
+
 		PlayerCollidedWithPickupEvent(std::shared_ptr<Player> player, std::shared_ptr<Pickup> pickup)
 			: Event(PlayerCollidedWithPickupEventId), ThePlayer(std::move(player)), ThePickup(std::move(pickup))
 		{
 		}
 
+		// Lets go of the player and pickup once delivered, when pooled
+		void Clear()
+		{
+			ThePlayer.reset();
+			ThePickup.reset();
+		}
+
 		std::shared_ptr<Player> ThePlayer;
 		std::shared_ptr<Pickup> ThePickup;
 	};
@@ -0,0 +1,68 @@
+#include "PooledEvents.h"
+#include <utility>
+#include <cppgamelib/events/EventFactory.h>
+
+namespace mazer
+{
+	namespace
+	{
+		EventPool<gamelib::Event> MakePlayerMovedPool(const gamelib::Direction direction)
+		{
+			return EventPool<gamelib::Event>([direction]
+				{
+					return std::shared_ptr<gamelib::Event>(gamelib::EventFactory::Get()->CreatePlayerMovedEvent(direction));
+				});
+		}
+
+		int GetDirectionIndex(const gamelib::Direction direction)
+		{
+			switch (direction)
+			{
+			case gamelib::Direction::Up: return 0;
+			case gamelib::Direction::Down: return 1;
+			case gamelib::Direction::Left: return 2;
+			case gamelib::Direction::Right: return 3;
+			default: return -1;
+			}
+		}
+	}
+
+	PooledEvents::PooledEvents()
+		: playerMovedEvents{ MakePlayerMovedPool(gamelib::Direction::Up), MakePlayerMovedPool(gamelib::Direction::Down),
+			MakePlayerMovedPool(gamelib::Direction::Left), MakePlayerMovedPool(gamelib::Direction::Right) }
+	{
+	}
+
+	std::shared_ptr<EnemyMovedEvent> PooledEvents::MakeEnemyMovedEvent(std::shared_ptr<Enemy> enemy)
+	{
+		auto event = enemyMovedEvents.Acquire();
+		event->TheEnemy = std::move(enemy);
+		return event;
+	}
+
+	std::shared_ptr<PlayerCollidedWithEnemyEvent> PooledEvents::MakePlayerCollidedWithEnemyEvent(
+		std::shared_ptr<Enemy> enemy, std::shared_ptr<Player> player)
+	{
+		auto event = playerCollidedWithEnemyEvents.Acquire();
+		event->TheEnemy = std::move(enemy);
+		event->ThePlayer = std::move(player);
+		return event;
+	}
+
+	std::shared_ptr<PlayerCollidedWithPickupEvent> PooledEvents::MakePlayerCollidedWithPickupEvent(
+		std::shared_ptr<Player> player, std::shared_ptr<Pickup> pickup)
+	{
+		auto event = playerCollidedWithPickupEvents.Acquire();
+		event->ThePlayer = std::move(player);
+		event->ThePickup = std::move(pickup);
+		return event;
+	}
+
+	std::shared_ptr<gamelib::Event> PooledEvents::MakePlayerMovedEvent(const gamelib::Direction direction)
+	{
+		const auto index = GetDirectionIndex(direction);
+		if (index < 0) { return gamelib::EventFactory::Get()->CreatePlayerMovedEvent(direction); }
+
+		return playerMovedEvents[index].Acquire();
+	}
+}
@@ -0,0 +1,44 @@
+#pragma once
+#ifndef POOLEDEVENTS_H
+#define POOLEDEVENTS_H
+
+#include <array>
+#include <memory>
+#include <cppgamelib/character/Direction.h>
+
+#include "EnemyMovedEvent.h"
+#include "EventPool.h"
+#include "PlayerCollidedWithEnemyEvent.h"
+#include "PlayerCollidedWithPickupEvent.h"
+
+namespace mazer
+{
+	/**
+	 * \brief Pools for the events a world raises many times a tick, such as an enemy moving or the player moving.
+	 *
+	 * Each event type has its own pool. An event is cleared and reused once it has been delivered, whoever delivers
+	 * it, instead of allocating a new one.
+	 */
+	class PooledEvents
+	{
+	public:
+		PooledEvents();
+
+		std::shared_ptr<EnemyMovedEvent> MakeEnemyMovedEvent(std::shared_ptr<Enemy> enemy);
+		std::shared_ptr<PlayerCollidedWithEnemyEvent> MakePlayerCollidedWithEnemyEvent(std::shared_ptr<Enemy> enemy,
+			std::shared_ptr<Player> player);
+		std::shared_ptr<PlayerCollidedWithPickupEvent> MakePlayerCollidedWithPickupEvent(std::shared_ptr<Player> player,
+			std::shared_ptr<Pickup> pickup);
+
+		// A player moved event carries only the direction, so each direction has a pool of unchanging events
+		std::shared_ptr<gamelib::Event> MakePlayerMovedEvent(gamelib::Direction direction);
+
+	private:
+		EventPool<EnemyMovedEvent> enemyMovedEvents;
+		EventPool<PlayerCollidedWithEnemyEvent> playerCollidedWithEnemyEvents;
+		EventPool<PlayerCollidedWithPickupEvent> playerCollidedWithPickupEvents;
+		std::array<EventPool<gamelib::Event>, 4> playerMovedEvents; // up, down, left, right
+	};
+}
+
+#endif
@@ -0,0 +1,20 @@
+#include "RandomService.h"
+#include <random>
+
+namespace mazer
+{
+	std::uint64_t RandomService::MakeSeed()
+	{
+		std::random_device device;
+		return static_cast<std::uint64_t>(device()) << 32 | device();
+	}
+
+	gamelib::Direction RandomService::GetRandomDirection(const std::uint64_t seed, const RandomDomain domain,
+		const std::uint64_t id)
+	{
+		constexpr gamelib::Direction directions[] = { gamelib::Direction::Up, gamelib::Direction::Down,
+			gamelib::Direction::Left, gamelib::Direction::Right };
+
+		return directions[GetStream(seed, domain, id).NextInt(4)];
+	}
+}
@@ -0,0 +1,38 @@
+#pragma once
+#ifndef RANDOMSERVICE_H
+#define RANDOMSERVICE_H
+
+#include <cstdint>
+#include <cppgamelib/character/Direction.h>
+
+#include "RandomStream.h"
+
+namespace mazer
+{
+	/**
+	 * \brief Makes seeds, and reproducible random streams derived from the seed of a level
+	 *
+	 * Holds no seed of its own: each level keeps its seed, so worlds loading levels on different threads share nothing.
+	 */
+	class RandomService
+	{
+	public:
+		RandomService() = delete;
+
+		// A new, unpredictable seed. This is the only place the operating system's entropy is used.
+		static std::uint64_t MakeSeed();
+
+		// The stream for one room, enemy, thread etc. of the level with the given seed
+		[[nodiscard]] static RandomStream GetStream(const std::uint64_t seed, const RandomDomain domain,
+			const std::uint64_t id = 0)
+		{
+			return RandomStream(seed).Derive(domain, id);
+		}
+
+		// Up, down, left or right
+		[[nodiscard]] static gamelib::Direction GetRandomDirection(std::uint64_t seed, RandomDomain domain,
+			std::uint64_t id);
+	};
+}
+
+#endif
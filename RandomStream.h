@@ -0,0 +1,97 @@
+#pragma once
+#ifndef RANDOMSTREAM_H
+#define RANDOMSTREAM_H
+
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+namespace mazer
+{
+	// What a random stream is used for. Streams derived for different domains never overlap, even for the same id.
+	enum class RandomDomain : std::uint64_t
+	{
+		Rooms = 1,
+		Enemies,
+		Pickups,
+		Threads, // one stream per worker thread, for work whose result may depend on scheduling
+		Tiles, // one stream per tile of a tiled maze, so the maze does not depend on scheduling
+		Seams,
+		Input // simulated player input
+	};
+
+	/**
+	 * \brief Counter-based random number generator.
+	 *
+	 * The n-th number of a stream is a hash of the stream's key and n, so streams cost nothing to create, any
+	 * position can be read directly with At() and independent streams are derived from a key and an id rather than
+	 * seeded from the operating system. The hash is the SplitMix64 finaliser, which gives the same sequence on every
+	 * platform. Satisfies UniformRandomBitGenerator.
+	 */
+	class RandomStream
+	{
+	public:
+		using result_type = std::uint64_t;
+
+		explicit RandomStream(const std::uint64_t key = 0, const std::uint64_t counter = 0)
+			: key(key), counter(counter)
+		{
+		}
+
+		static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+		static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+		result_type operator()() { return At(counter++); }
+
+		// The number at the given position of the stream, without moving the stream
+		[[nodiscard]] result_type At(const std::uint64_t position) const { return Mix(key + (position + 1) * Gamma); }
+
+		// An independent stream for the given id
+		[[nodiscard]] RandomStream Derive(const std::uint64_t id) const { return RandomStream(Mix(key ^ Mix(id))); }
+		[[nodiscard]] RandomStream Derive(const RandomDomain domain) const { return Derive(static_cast<std::uint64_t>(domain)); }
+		[[nodiscard]] RandomStream Derive(const RandomDomain domain, const std::uint64_t id) const { return Derive(domain).Derive(id); }
+
+		// Uniform in [0, bound)
+		int NextInt(const int bound) { return ToRange(operator()(), bound); }
+		bool NextBool() { return operator()() >> 63; }
+
+		// Uniform in [0, 1)
+		double NextDouble() { return static_cast<double>(operator()() >> 11) * 0x1.0p-53; }
+
+		// Fisher-Yates shuffle. Unlike std::shuffle the result is the same with every standard library.
+		template <typename RandomIt>
+		void Shuffle(RandomIt first, RandomIt last)
+		{
+			for (auto size = static_cast<int>(std::distance(first, last)); size > 1; size--)
+			{
+				using std::swap;
+				swap(first[size - 1], first[NextInt(size)]);
+			}
+		}
+
+		[[nodiscard]] std::uint64_t GetKey() const { return key; }
+		[[nodiscard]] std::uint64_t GetCounter() const { return counter; }
+
+		// Maps a random number to [0, bound) with a multiply instead of a division
+		static int ToRange(const result_type value, const int bound)
+		{
+			return static_cast<int>(((value >> 32) * static_cast<std::uint64_t>(bound)) >> 32);
+		}
+
+		static constexpr std::uint64_t Mix(std::uint64_t value)
+		{
+			value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+			value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+			return value ^ (value >> 31);
+		}
+
+	private:
+		static constexpr std::uint64_t Gamma = 0x9E3779B97F4A7C15ull;
+
+		std::uint64_t key;
+		std::uint64_t counter;
+	};
+}
+
+#endif
@@ -10,13 +10,10 @@
 #include "GameData.h"
 #include "GameDataManager.h"
 #include "geometry/SideUtils.h"
-#include "file/SettingsManager.h"
+#include "MazerSettings.h"
 #include <utils/Utils.h>
 
-#include "Enemy.h"
-#include "EnemyMovedEvent.h"
 #include "RoomInfo.h"
-#include "events/PlayerMovedEvent.h"
 #include "file/Logger.h"
 
 using namespace std;
@@ -26,30 +23,32 @@ namespace mazer
 {
 
 	Room::Room(const string& name, const string& type, const int number, const int x, const int y, const int width,
-		const int height, const bool fill)
-		: DrawableGameObject(name, type, Coordinate(x, y), true)
+		const int height, const bool fill, World& world)
+		: Room(name, type, std::make_shared<MazeGrid>(1, 1), number, x, y, width, height, fill, world)
+	{
+		// A stand-alone room is the only cell of its own grid
+		this->cell = 0;
+	}
+
+	Room::Room(const string& name, const string& type, const std::shared_ptr<MazeGrid>& grid, const int number,
+		const int x, const int y, const int width, const int height, const bool fill, World& world)
+		: DrawableGameObject(name, type, Coordinate(x, y), true), world(&world)
 	{
 		this->Bounds = { x, y, width, height };
 		this->width = width;
 		this->height = height;
 		this->roomNumber = number;
-		this->logWallRemovals = false;
+		this->grid = grid;
+		this->cell = number;
 		this->fill = fill;
-		this->topRoomIndex = 0;
-		this->rightRoomIndex = 0;
-		this->bottomRoomIndex = 0;
-		this->width = width;
-		this->height = height;
-		this->leftRoomIndex = 0;
-		this->innerBoundsOffset = 0;
 		this->abcd = AbcdRectangle(x, y, width, height);
 
-		UpdateInnerBounds(); // We only need to update the bounds once, so do it in the constructor only
-		SetupWalls();
+		UpdateInnerBounds(); // again when settings are loaded or reloaded
 	}
 
 	void Room::UpdateInnerBounds()
 	{
+		const auto innerBoundsOffset = settings->Room.InnerBoundsOffset;
 		this->InnerBounds = SDL_Rect
 		{
 			Bounds.x + innerBoundsOffset,
@@ -59,7 +58,7 @@ namespace mazer
 		};
 	}
 
-	void Room::SetupWalls()
+	Line Room::GetWallLine(const Side side) const
 	{
 		/*
 			A(ax,ay)----B(bx,by)
@@ -68,123 +67,52 @@ namespace mazer
 			D(dx,dy)----C(cx,cy)
 		*/
 
-		// Calculate the geometry of the walls
+		// Calculate the geometry of the wall
 		const auto& rect = this->abcd;
-		const auto ax = rect.GetAx();
-		const auto ay = rect.GetAy();
-		const auto bx = rect.GetBx();
-		const auto by = rect.GetBy();
-		const auto cx = rect.GetCx();
-		const auto cy = rect.GetCy();
-		const auto dx = rect.GetDx();
-		const auto dy = rect.GetDy();
-
-		// Top wall line geometry
-		TopLine.X1 = ax;
-		TopLine.Y1 = ay;
-		TopLine.X2 = bx;
-		TopLine.Y2 = by;
-
-		// Right wall line geometry
-		RightLine.X1 = bx;
-		RightLine.Y1 = by;
-		RightLine.X2 = cx;
-		RightLine.Y2 = cy;
-
-		// Bottom wall line geometry
-		BottomLine.X1 = cx;
-		BottomLine.Y1 = cy;
-		BottomLine.X2 = dx;
-		BottomLine.Y2 = dy;
-
-		// Left wall line geometry
-		LeftLine.X1 = dx;
-		LeftLine.Y1 = dy;
-		LeftLine.X2 = ax;
-		LeftLine.Y2 = ay;
-
-		// All walls are present by default
-		walls[0] = walls[1] = walls[2] = walls[3] = IsLeftWalled = IsTopWalled = IsRightWalled = IsBottomWalled = true;
-	}
+		Line line;
 
-	void Room::UpdateEnemyRoom(const std::shared_ptr<Enemy>& enemy)
-	{
-		const auto npcHotspot = enemy->TheHotspot->GetBounds();
-		SDL_Rect _;
-
-		if (SDL_IntersectRect(&InnerBounds, &npcHotspot, &_))
+		switch (side)
 		{
-			enemy->CurrentRoom->SetCurrentRoom(shared_from_this());
+		case Side::Top: line.X1 = rect.GetAx(); line.Y1 = rect.GetAy(); line.X2 = rect.GetBx(); line.Y2 = rect.GetBy(); break;
+		case Side::Right: line.X1 = rect.GetBx(); line.Y1 = rect.GetBy(); line.X2 = rect.GetCx(); line.Y2 = rect.GetCy(); break;
+		case Side::Bottom: line.X1 = rect.GetCx(); line.Y1 = rect.GetCy(); line.X2 = rect.GetDx(); line.Y2 = rect.GetDy(); break;
+		case Side::Left: line.X1 = rect.GetDx(); line.Y1 = rect.GetDy(); line.X2 = rect.GetAx(); line.Y2 = rect.GetAy(); break;
+		default: break;
 		}
+		return line;
 	}
 
-	void Room::Update(const unsigned long deltaMs) { /* Not need to update */ }
-
-	ListOfEvents Room::HandleEvent(const std::shared_ptr<Event>& event, const unsigned long deltaMs)
+	void Room::Update(const unsigned long deltaMs)
 	{
-		ListOfEvents generatedEvents = {};
-
-		if (event->Id.PrimaryId == PlayerMovedEventTypeEventId.PrimaryId)
-		{
-			OnPlayerMoved(generatedEvents);
-		}
-		else if (event->Id.PrimaryId == SettingsReloadedEventId.PrimaryId)
-		{
-			LoadSettings();
-		}
-		else if (event->Id.PrimaryId == EnemyMovedEventId.PrimaryId)
-		{
-			UpdateEnemyRoom(To<EnemyMovedEvent>(event)->TheEnemy);
-		}
-		else
-		{
-			std::stringstream message("Unhandled subscribed event in Room class:");
-			message << event->ToString();
-			Logger::Get()->LogThis(message.str());
-		}
-		return {};
+		// Only what is derived from the settings changes, and only after a reload
+		if (settings.Refresh()) { ApplySettings(); }
 	}
 
-	ListOfEvents& Room::OnPlayerMoved(ListOfEvents& generatedEvents)
+	ListOfEvents Room::HandleEvent(const std::shared_ptr<Event>& event, const unsigned long deltaMs)
 	{
-		if (!trackEnemies) return generatedEvents;
-
-		const auto player = To<Player>(GameData::Get()->player.lock());
-		const auto playerHotSpotBounds = player->Hotspot->GetBounds();
-		SDL_Rect result;
-
-		isPlayerWithinRoom = SDL_IntersectRect(&InnerBounds, &playerHotSpotBounds, &result);
-		if (isPlayerWithinRoom) { player->CurrentRoom->SetCurrentRoom(shared_from_this()); }
-
-		return generatedEvents;
+		// Rooms subscribe to nothing: players and enemies work out which room they are in themselves
+		std::stringstream message("Unhandled subscribed event in Room class:");
+		message << event->ToString();
+		Logger::Get()->LogThis(message.str());
+		return {};
 	}
 
 	void Room::DrawWalls(SDL_Renderer* renderer) const
 	{
-		if (HasTopWall()) { DrawLine(renderer, TopLine); }
-		if (HasRightWall()) { DrawLine(renderer, RightLine); }
-		if (HasBottomWall()) { DrawLine(renderer, BottomLine); }
-		if (HasLeftWall()) { DrawLine(renderer, LeftLine); }
+		if (HasTopWall()) { DrawLine(renderer, GetWallLine(Side::Top)); }
+		if (HasRightWall()) { DrawLine(renderer, GetWallLine(Side::Right)); }
+		if (HasBottomWall()) { DrawLine(renderer, GetWallLine(Side::Bottom)); }
+		if (HasLeftWall()) { DrawLine(renderer, GetWallLine(Side::Left)); }
 	}
 
-	std::shared_ptr<Room> Room::GetSideRoom(const Side side)
+	std::shared_ptr<Room> Room::GetSideRoom(const Side side) const
 	{
-		switch (side)
-		{
-		case Side::Top: return topRoom;
-		case Side::Right: return rightRoom;
-		case Side::Bottom: return bottomRoom;
-		case Side::Left: return leftRoom;
-		default: return topRoom; // should never happen  // NOLINT(clang-diagnostic-covered-switch-default)
-		}
+		return world->Data().GetRoomByIndex(GetNeighborIndex(side));
 	}
 
 	void Room::Initialize()
 	{
 		LoadSettings();
-		SubscribeToEvent(PlayerMovedEventTypeEventId);
-		SubscribeToEvent(SettingsReloadedEventId);
-		SubscribeToEvent(EnemyMovedEventId);
 	}
 
 	void Room::DrawLine(SDL_Renderer* renderer, const Line& line)
@@ -198,15 +126,15 @@ namespace mazer
 		constexpr SDL_Color yellow = { 255, 255, 0, 0 };
 		if (fill) { DrawFilledRect(renderer, &Bounds, { 255, 0, 0, 0 }); }
 
-		if (printDebuggingText)
+		if (settings->Room.PrintDebuggingText)
 		{
-			const auto player = GameData::Get()->GetPlayer();
+			const auto player = world->Data().GetPlayer();
 
-			if (printDebuggingTextNeighborsOnly)
+			if (settings->Room.PrintDebuggingTextNeighborsOnly)
 			{
 				const auto playerRoom = player->CurrentRoom->GetCurrentRoom();
-				if (roomNumber == playerRoom->topRoomIndex || roomNumber == playerRoom->rightRoomIndex ||
-					roomNumber == playerRoom->bottomRoomIndex || roomNumber == playerRoom->leftRoomIndex)
+				if (roomNumber == playerRoom->GetNeighborIndex(Side::Top) || roomNumber == playerRoom->GetNeighborIndex(Side::Right) ||
+					roomNumber == playerRoom->GetNeighborIndex(Side::Bottom) || roomNumber == playerRoom->GetNeighborIndex(Side::Left))
 				{
 					RectDebugging::PrintInRect(renderer, GetTag(), &Bounds, yellow);
 				}
@@ -222,14 +150,14 @@ namespace mazer
 			}
 		}
 
-		if (drawHotSpot)
+		if (settings->Room.DrawHotSpot)
 		{
 			const SDL_Rect pointBounds = { GetPosition().GetX() - width / 2, GetPosition().GetY() + height / 2, 0, 0 };
 			constexpr SDL_Color cyan = { 0, 255, 255, 0 };
 			DrawFilledRect(renderer, &pointBounds, cyan);
 		}
 
-		if (drawInnerBounds)
+		if (settings->Room.DrawInnerBounds)
 		{
 			SDL_SetRenderDrawColor(renderer, yellow.r, yellow.g, yellow.b, yellow.a);
 			SDL_RenderDrawRect(renderer, &InnerBounds);
@@ -239,6 +167,8 @@ namespace mazer
 
 	void Room::Draw(SDL_Renderer* renderer)
 	{
+		if (settings.Refresh()) { ApplySettings(); }
+
 		DrawableGameObject::Draw(renderer);
 		SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0); // Black
 		DrawWalls(renderer);
@@ -249,15 +179,13 @@ namespace mazer
 	{
 		GameObject::LoadSettings();
 
-		fill = SettingsManager::Bool("room_fill", "enable");
-		innerBoundsOffset = SettingsManager::Int("room", "innerBoundsOffset");
-		logWallRemovals = SettingsManager::Bool("room", "logWallRemovals");
-		drawInnerBounds = SettingsManager::Bool("room", "drawInnerBounds");
-		drawHotSpot = SettingsManager::Bool("room", "drawHotSpot");
-		printDebuggingTextNeighborsOnly = SettingsManager::Bool("global", "print_debugging_text_neighbours_only");
-		printDebuggingText = SettingsManager::Bool("global", "print_debugging_text");
-		trackEnemies = SettingsManager::Bool("room", "trackEnemies");
+		settings.Load();
+		ApplySettings();
+	}
 
+	void Room::ApplySettings()
+	{
+		fill = settings->Room.Fill;
 		UpdateInnerBounds();
 	}
 
@@ -267,7 +195,7 @@ namespace mazer
 	int Room::GetWidth() const { return width; }
 	int Room::GetHeight() const { return height; }
 
-	bool Room::IsWalled(Side wall) const { return walls[static_cast<int>(wall)]; }
+	bool Room::IsWalled(const Side wall) const { return grid->IsWalled(cell, wall); }
 
 	bool Room::HasTopWall() const { return IsWalled(Side::Top); }
 	bool Room::HasBottomWall() const { return IsWalled(Side::Bottom); }
@@ -279,16 +207,16 @@ namespace mazer
 	int Room::GetRoomNumber() const { return roomNumber; }
 	int Room::GetRowNumber(const int maxCols) const { return GetRoomNumber() / maxCols; }
 
-	void Room::AddWall(Side wall)
+	void Room::AddWall(const Side wall)
 	{
-		this->walls[static_cast<int>(wall)] = true;
-		SetWalled(wall);
+		grid->AddWall(cell, wall);
+		world->Data().OnWallChanged(*grid, cell, wall);
 	}
 
-	void Room::RemoveWallZeroBased(Side wall)
+	void Room::RemoveWallZeroBased(const Side wall)
 	{
-		this->walls[static_cast<int>(wall)] = false;
-		SetNotWalled(wall);
+		grid->RemoveWall(cell, wall);
+		world->Data().OnWallChanged(*grid, cell, wall);
 	}
 
 	void Room::ShouldRoomFill(const bool fillMe) { fill = fillMe; }
@@ -306,19 +234,6 @@ namespace mazer
 		return "Room";
 	}
 
-	void Room::SetSurroundingRooms(const int top_index, const int rightIndex, const int bottomIndex, const int leftIndex,
-		const std::vector<shared_ptr<Room>>& rooms)
-	{
-		this->topRoomIndex = top_index;
-		this->topRoom = rooms[topRoomIndex < 1 ? 0 : topRoomIndex];
-		this->rightRoomIndex = rightIndex;
-		this->rightRoom = rooms[rightRoomIndex < 1 ? 0 : rightRoomIndex];
-		this->bottomRoomIndex = bottomIndex;
-		this->bottomRoom = rooms[bottomRoomIndex < 1 ? 0 : bottomRoomIndex];
-		this->leftRoomIndex = leftIndex;
-		this->leftRoom = rooms[leftRoomIndex < 1 ? 0 : leftRoomIndex];
-	}
-
 	// ReSharper disable once CppParameterNamesMismatch
 	Coordinate<int> Room::GetCenter(const int w, const int h) const
 	{
@@ -345,52 +260,24 @@ namespace mazer
 
 	int Room::GetNeighborIndex(const Side index) const
 	{
-		switch (index)
-		{
-		case Side::Top: return topRoomIndex;
-		case Side::Right: return rightRoomIndex;
-		case Side::Bottom: return bottomRoomIndex;
-		case Side::Left: return leftRoomIndex;
-		}
-		return 0;
+		// Neighbors are derived from the grid, stand-alone rooms have none
+		return grid->GetNeighborIndex(cell, index);
 	}
 
-	void Room::RemoveWall(Side wall)
+	void Room::RemoveWall(const Side wall)
 	{
-		walls[static_cast<int>(wall)] = false;
-		SetNotWalled(wall);
+		grid->RemoveWall(cell, wall);
+		world->Data().OnWallChanged(*grid, cell, wall);
 		LogWallRemoval(wall);
 	}
 
 	void Room::LogWallRemoval(const Side wall) const
 	{
-		if (logWallRemovals)
+		if (settings->Room.LogWallRemovals)
 		{
 			std::stringstream message;
 			message << "Removed " << SideUtils::SideToString(wall) << " wall in room number " << GetRoomNumber();
 			Logger::Get()->LogThis(message.str());
 		}
 	}
-
-	void Room::SetNotWalled(const Side wall)
-	{
-		switch (wall)
-		{
-		case Side::Top: IsTopWalled = false; break;
-		case Side::Bottom: IsBottomWalled = false; break;
-		case Side::Left: IsLeftWalled = false; break;
-		case Side::Right: IsRightWalled = false; break;
-		}
-	}
-
-	void Room::SetWalled(const Side wall)
-	{
-		switch (wall)
-		{
-		case Side::Top: { IsTopWalled = true; } break;
-		case Side::Bottom: { IsBottomWalled = true; } break;
-		case Side::Left: { IsLeftWalled = true; } break;
-		case Side::Right: { IsRightWalled = true; } break;
-		}
-	}
 }
@@ -3,15 +3,26 @@
 #include <geometry/Side.h>
 #include <objects/DrawableGameObject.h>
 
+#include "MazeGrid.h"
+#include "MazerSettings.h"
+#include "SlotMap.h"
+#include "World.h"
+
 namespace mazer
 {
 	class Enemy;
 
+	// A room is a view over one cell of a MazeGrid, which is the source of truth for its walls
 	class Room final : public gamelib::DrawableGameObject, public std::enable_shared_from_this<Room>
 	{
 	public:
+		// A stand-alone room, backed by its own 1x1 grid
 		Room(const std::string& name, const std::string& type, int number, int x, int y, int width, int height,
-			bool fill = false);
+			bool fill = false, World& world = World::Default());
+
+		// A room that is cell 'number' of the given grid
+		Room(const std::string& name, const std::string& type, const std::shared_ptr<MazeGrid>& grid, int number, int x,
+			int y, int width, int height, bool fill = false, World& world = World::Default());
 
 		bool IsWalled(gamelib::Side wall) const;
 		bool HasTopWall() const;
@@ -20,20 +31,15 @@ namespace mazer
 		bool HasRightWall() const;
 
 		void UpdateInnerBounds();
-		void SetupWalls();
 
-		void SetSurroundingRooms(int top_index, int rightIndex, int bottomIndex, int leftIndex,
-			const std::vector<std::shared_ptr<
-			Room>>&rooms);
 		void RemoveWall(gamelib::Side wall);
 		void LogWallRemoval(gamelib::Side wall) const;
-		void SetNotWalled(gamelib::Side wall);
-		void SetWalled(gamelib::Side wall);
 		void AddWall(gamelib::Side wall);
 		void RemoveWallZeroBased(gamelib::Side wall);
 		void ShouldRoomFill(bool fillMe = false);
 		void DrawWalls(SDL_Renderer* renderer) const;
-		std::shared_ptr<Room> GetSideRoom(gamelib::Side side);
+		std::shared_ptr<Room> GetSideRoom(gamelib::Side side) const;
+		gamelib::Line GetWallLine(gamelib::Side side) const;
 		void Initialize();
 		static void DrawLine(SDL_Renderer* renderer, const gamelib::Line& line);
 		void DrawDiagnostics(SDL_Renderer* renderer);
@@ -42,7 +48,6 @@ namespace mazer
 
 		gamelib::GameObjectType GetGameObjectType() override { return gamelib::GameObjectType::game_defined; }
 		gamelib::ListOfEvents HandleEvent(const std::shared_ptr<gamelib::Event>& event, const unsigned long deltaMs) override;
-		gamelib::ListOfEvents& OnPlayerMoved(std::vector<std::shared_ptr<gamelib::Event>>& generatedEvents);
 		gamelib::Coordinate<int> GetCenter(int width, int height) const;
 		gamelib::Coordinate<int> GetCenter() const;
 		gamelib::Coordinate<int> GetCenter(const gamelib::AbcdRectangle& rectangle) const;
@@ -56,52 +61,31 @@ namespace mazer
 		int GetRoomNumber() const;
 		int GetRowNumber(int maxCols) const;
 		int GetColumnNumber(int maxCols) const;
+		[[nodiscard]] const std::shared_ptr<MazeGrid>& GetGrid() const { return grid; }
+		[[nodiscard]] World& GetWorld() const { return *world; }
 
 		std::string GetName() override;
 
 		SDL_Rect InnerBounds{};
-
-		bool IsTopWalled{};
-		bool IsBottomWalled{};
-		bool IsRightWalled{};
-		bool IsLeftWalled{};
-
-		gamelib::Line TopLine;
-		gamelib::Line RightLine;
-		gamelib::Line BottomLine;
-		gamelib::Line LeftLine;
+		SlotHandle Handle; // in the game data, while registered
 
 	protected:
 		int roomNumber;
-		bool walls[4]{};
+		std::shared_ptr<MazeGrid> grid;
+		int cell; // index of this room in the grid
 		gamelib::AbcdRectangle abcd{};
 		gamelib::AbcdRectangle& GetAbcdRectangle();
-		int topRoomIndex;
-		std::shared_ptr<Room> rightRoom;
-		std::shared_ptr<Room> leftRoom;
-		std::shared_ptr<Room> topRoom;
-		std::shared_ptr<Room> bottomRoom;
-		int rightRoomIndex;
-		int bottomRoomIndex;
-		int leftRoomIndex;
 		int width;
 		int height;
 
-	private:
-		void UpdateEnemyRoom(const std::shared_ptr<Enemy>& enemy);
-
 	public:
 		void Update(unsigned long deltaMs) override;
 
 	private:
-		bool isPlayerWithinRoom = false;
+		void ApplySettings(); // to what is derived from the settings
+
+		World* world;
 		bool fill = false;
-		int innerBoundsOffset;
-		bool logWallRemovals;
-		bool drawInnerBounds{};
-		bool drawHotSpot{};
-		bool printDebuggingTextNeighborsOnly{};
-		bool printDebuggingText{};
-		bool trackEnemies{};
+		CurrentSettings settings;
 	};
 }
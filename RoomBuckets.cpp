@@ -0,0 +1,49 @@
+#include "RoomBuckets.h"
+#include <algorithm>
+#include <utility>
+
+namespace mazer
+{
+	const std::vector<SlotHandle> RoomBuckets::none;
+
+	void RoomBuckets::Add(const int room, const SlotHandle handle)
+	{
+		if (room < 0) { return; }
+
+		if (static_cast<std::size_t>(room) >= buckets.size()) { buckets.resize(static_cast<std::size_t>(room) + 1); }
+		buckets[room].push_back(handle);
+		count++;
+	}
+
+	bool RoomBuckets::Remove(const int room, const SlotHandle handle)
+	{
+		if (static_cast<std::size_t>(room) >= buckets.size()) { return false; }
+
+		auto& bucket = buckets[room];
+		const auto found = std::find(bucket.begin(), bucket.end(), handle);
+		if (found == bucket.end()) { return false; }
+
+		RemoveAt(bucket, static_cast<std::size_t>(found - bucket.begin()));
+		return true;
+	}
+
+	void RoomBuckets::Move(const SlotHandle handle, const int from, const int to)
+	{
+		if (from == to) { return; }
+		if (Remove(from, handle)) { Add(to, handle); }
+	}
+
+	void RoomBuckets::Clear()
+	{
+		buckets.clear();
+		count = 0;
+	}
+
+	void RoomBuckets::RemoveAt(std::vector<SlotHandle>& bucket, const std::size_t index)
+	{
+		// The order within a room does not matter, so the last handle fills the hole
+		if (index + 1 != bucket.size()) { bucket[index] = std::move(bucket.back()); }
+		bucket.pop_back();
+		count--;
+	}
+}
@@ -0,0 +1,64 @@
+#pragma once
+#ifndef ROOMBUCKETS_H
+#define ROOMBUCKETS_H
+
+#include <cstddef>
+#include <vector>
+
+#include "SlotMap.h"
+
+namespace mazer
+{
+	/**
+	 * \brief The objects in each room of a maze, so that what the player can touch is found by looking in its rooms.
+	 *
+	 * Each room has a bucket of handles. Adding, moving and removing an object only touches the buckets of the rooms
+	 * involved, and finding what is in a room costs the number of objects in it, however many there are in the maze.
+	 * Handles of objects that have since been removed can be left behind; RemoveIf drops them.
+	 */
+	class RoomBuckets
+	{
+	public:
+		void Add(int room, SlotHandle handle);
+
+		// Returns false if the handle is not in the room's bucket
+		bool Remove(int room, SlotHandle handle);
+
+		// Moves a handle between buckets. Does nothing unless it is in the bucket of the room it moves from
+		void Move(SlotHandle handle, int from, int to);
+
+		// Drops the handles for which the predicate is true, from every bucket
+		template <typename Predicate>
+		void RemoveIf(Predicate predicate)
+		{
+			for (auto& bucket : buckets)
+			{
+				for (std::size_t i = 0; i < bucket.size();)
+				{
+					if (predicate(bucket[i])) { RemoveAt(bucket, i); }
+					else { i++; }
+				}
+			}
+		}
+
+		void Clear();
+
+		// The handles in a room, empty for rooms with nothing in them
+		[[nodiscard]] const std::vector<SlotHandle>& Get(const int room) const
+		{
+			return static_cast<std::size_t>(room) < buckets.size() ? buckets[room] : none;
+		}
+
+		[[nodiscard]] std::size_t size() const { return count; }
+		[[nodiscard]] bool empty() const { return count == 0; }
+
+	private:
+		void RemoveAt(std::vector<SlotHandle>& bucket, std::size_t index);
+
+		std::vector<std::vector<SlotHandle>> buckets; // by room number
+		std::size_t count = 0;
+		static const std::vector<SlotHandle> none;
+	};
+}
+
+#endif
@@ -1,12 +1,12 @@
 #include "pch.h"
 #include "RoomGenerator.h"
-#include <algorithm>
-#include <random>
+#include <array>
 #include <vector>
-#include <file/SettingsManager.h>
 
+#include "MazeGrid.h"
+#include "MazerSettings.h"
+#include "RandomService.h"
 #include "Room.h"
-#include "Rooms.h"
 
 using namespace std;
 using namespace gamelib;
@@ -16,50 +16,37 @@ namespace mazer
 
 	RoomGenerator::RoomGenerator(const int screenWidth, const int screenHeight, const int rows, const int columns,
 		const bool removeRandomSides)
+		: RoomGenerator(screenWidth, screenHeight, rows, columns, removeRandomSides, RandomService::MakeSeed())
+	{
+	}
+
+	RoomGenerator::RoomGenerator(const int screenWidth, const int screenHeight, const int rows, const int columns,
+		const bool removeRandomSides, const std::uint64_t seed)
+		: roomStreams(RandomStream(seed).Derive(RandomDomain::Rooms))
 	{
 		this->screenWidth = screenWidth;
 		this->screenHeight = screenHeight;
 		this->rows = rows;
 		this->columns = columns;
 		this->removeRandomSides = removeRandomSides;
+		this->noWalls = MazerSettings::Get()->Grid.NoWalls;
 	}
 
 	vector<shared_ptr<Room>> RoomGenerator::Generate() const
 	{
-		vector<shared_ptr<Room>> rooms;
-		auto count = 0;
-		const auto squareWidth = screenWidth / columns;
-		const auto squareHeight = screenHeight / rows;
-
-		for (auto row = 0; row < rows; row++)
-		{
-			for (auto col = 0; col < columns; col++)
-			{
-				const auto number = count++;
-				auto roomName = string("Room") + std::to_string(number);
-				auto room = std::make_shared<Room>(roomName, "Room", number, col * squareWidth, row * squareHeight,
-					squareWidth, squareHeight, false);
-				room->SetTag(std::to_string(number));
-				rooms.push_back(room);
-			}
-		}
-
-		ConfigureRooms(rooms);
-
-		return rooms;
+		return CreateRooms(GenerateGrid());
 	}
 
-	void RoomGenerator::ConfigureRooms(const std::vector<std::shared_ptr<Room>>& rooms) const
+	shared_ptr<MazeGrid> RoomGenerator::GenerateGrid() const
 	{
-		const auto totalRooms = static_cast<int>(rooms.size());
+		auto grid = std::make_shared<MazeGrid>(rows, columns);
+		const auto totalRooms = grid->GetRoomCount();
 
 		// Setup room
 		for (auto i = 0; i < totalRooms; i++)
 		{
-			const auto nextIndex = i + 1;
-			const auto prevIndex = i - 1;
-			const auto roomRow = static_cast<int>(ceil(i / columns));
-			const auto roomCol = i % columns;
+			const auto roomRow = grid->GetRow(i);
+			const auto roomCol = grid->GetColumn(i);
 
 			// Prevent removing outer walls 
 			auto canRemoveTopWall = roomRow >= 1 && roomRow <= rows - 1;
@@ -67,96 +54,68 @@ namespace mazer
 			auto canRemoveLeftWall = roomCol > 0 && roomCol <= columns - 1;
 			auto canRemoveRightWall = roomCol >= 0 && roomCol < columns - 1;
 
-			// Calculate indexes of sorrounding/adjacent rooms
-			const auto roomIndexAbove = canRemoveTopWall ? i - columns : i;
-			const auto roomIndexBelow = canRemoveBottomWall ? i + columns : i;
-			const auto roomIndexLeft = canRemoveLeftWall ? prevIndex : i;
-			const auto roomIndexRight = canRemoveRightWall ? nextIndex : i;
-			auto& thisRoom = rooms[i];
-			auto& nextRoom = nextIndex == totalRooms ? rooms[i] : rooms[nextIndex];
-
-			thisRoom->SetSurroundingRooms(roomIndexAbove, roomIndexRight, roomIndexBelow, roomIndexLeft, rooms);
-
-			ConfigureWalls(thisRoom, canRemoveTopWall, rooms, nextRoom, canRemoveRightWall, canRemoveBottomWall,
-				canRemoveLeftWall, prevIndex);
+			ConfigureWalls(*grid, i, canRemoveTopWall, canRemoveRightWall, canRemoveBottomWall, canRemoveLeftWall);
 		}
-	}
 
-	void RoomGenerator::ConfigureWalls(const std::shared_ptr<Room>& thisRoom, const bool& canRemoveWallAbove,
-		const std::vector<std::shared_ptr<Room>>& rooms,
-		const std::shared_ptr<Room>& nextRoom, const bool& canRemoveWallRight,
-		const bool& canRemoveWallBelow, const bool& canRemoveWallLeft,
-		const int& prevIndex) const
-	{
-		if (SettingsManager::Get()->GetBool("grid", "nowalls"))
-		{
-			Rooms::RemoveAllWalls(thisRoom);
-			return;
-		}
-
-		RemoveSidesRandomly(canRemoveWallAbove, thisRoom, rooms, nextRoom, canRemoveWallRight, canRemoveWallBelow,
-			canRemoveWallLeft, prevIndex);
+		return grid;
 	}
 
-
-	void RoomGenerator::RemoveSidesRandomly(const bool& canRemoveAbove, const std::shared_ptr<Room>& currentRoom,
-		const std::vector<std::shared_ptr<Room>>& rooms,
-		const std::shared_ptr<Room>& nextRoom,
-		const bool& canRemoveRight, const bool& canRemoveBelow,
-		const bool& canRemoveLeft, const int& prevIndex) const
+	vector<shared_ptr<Room>> RoomGenerator::CreateRooms(const shared_ptr<MazeGrid>& grid, World& world) const
 	{
-		vector<Side> removableSides;
+		vector<shared_ptr<Room>> rooms;
+		const auto squareWidth = screenWidth / columns;
+		const auto squareHeight = screenHeight / rows;
 
-		if (canRemoveAbove) { removableSides.push_back(Side::Top); }
-		if (canRemoveBelow) { removableSides.push_back(Side::Bottom); }
-		if (canRemoveLeft) { removableSides.push_back(Side::Left); }
-		if (canRemoveRight) { removableSides.push_back(Side::Right); }
+		rooms.reserve(grid->GetRoomCount());
 
-		if (removeRandomSides)
+		for (auto row = 0; row < rows; row++)
 		{
-			vector<Side> sidesToSample;
-			std::sample(begin(removableSides), end(removableSides), std::back_inserter(sidesToSample), 1,
-				std::mt19937{ std::random_device{}() });
-
-			const auto randomSide = sidesToSample.front();
-
-			if (randomSide == Side::Top && canRemoveAbove)
+			for (auto col = 0; col < columns; col++)
 			{
-				currentRoom->RemoveWallZeroBased(Side::Top);
-				const auto& roomAbove = rooms[currentRoom->GetNeighborIndex(Side::Top)];
-
-				roomAbove->RemoveWallZeroBased(Side::Bottom);
-				nextRoom->RemoveWallZeroBased(Side::Bottom);
+				const auto number = grid->GetIndex(row, col);
+				auto roomName = string("Room") + std::to_string(number);
+				auto room = std::make_shared<Room>(roomName, "Room", grid, number, col * squareWidth,
+					row * squareHeight, squareWidth, squareHeight, false, world);
+				room->SetTag(std::to_string(number));
+				rooms.push_back(room);
 			}
+		}
 
-			if (randomSide == Side::Right && canRemoveRight)
-			{
-				currentRoom->RemoveWallZeroBased(Side::Right);
-				const auto& roomToLeft = rooms[currentRoom->GetNeighborIndex(Side::Right)];
+		return rooms;
+	}
 
-				roomToLeft->RemoveWallZeroBased(Side::Left);
-				nextRoom->RemoveWallZeroBased(Side::Left);
-			}
+	void RoomGenerator::ConfigureWalls(MazeGrid& grid, const int index, const bool& canRemoveWallAbove,
+		const bool& canRemoveWallRight, const bool& canRemoveWallBelow, const bool& canRemoveWallLeft) const
+	{
+		if (noWalls)
+		{
+			grid.RemoveWall(index, Side::Top);
+			grid.RemoveWall(index, Side::Right);
+			grid.RemoveWall(index, Side::Bottom);
+			grid.RemoveWall(index, Side::Left);
+			return;
+		}
 
-			if (randomSide == Side::Bottom && canRemoveBelow)
-			{
-				currentRoom->RemoveWallZeroBased(Side::Bottom);
-				const auto& roomBelow = rooms[currentRoom->GetNeighborIndex(Side::Bottom)];
+		RemoveSidesRandomly(grid, index, canRemoveWallAbove, canRemoveWallRight, canRemoveWallBelow, canRemoveWallLeft);
+	}
 
-				roomBelow->RemoveWallZeroBased(Side::Top);
-				nextRoom->RemoveWallZeroBased(Side::Top);
-			}
 
-			if (randomSide == Side::Left && canRemoveLeft)
-			{
-				currentRoom->RemoveWallZeroBased(Side::Left);
-				const auto& prev = rooms[prevIndex];
+	void RoomGenerator::RemoveSidesRandomly(MazeGrid& grid, const int index, const bool& canRemoveAbove,
+		const bool& canRemoveRight, const bool& canRemoveBelow, const bool& canRemoveLeft) const
+	{
+		if (!removeRandomSides) { return; }
 
-				const auto& roomOnLeft = rooms[currentRoom->GetNeighborIndex(Side::Left)];
+		array<Side, 4> removableSides{};
+		auto count = 0;
+		if (canRemoveAbove) { removableSides[count++] = Side::Top; }
+		if (canRemoveBelow) { removableSides[count++] = Side::Bottom; }
+		if (canRemoveLeft) { removableSides[count++] = Side::Left; }
+		if (canRemoveRight) { removableSides[count++] = Side::Right; }
 
-				roomOnLeft->RemoveWallZeroBased(Side::Right);
-				prev->RemoveWallZeroBased(Side::Right);
-			}
-		}
+		if (count == 0) { return; }
+
+		// The wall shared with the neighbor is stored once, so removing it opens both rooms
+		const auto randomSide = removableSides[RandomStream::ToRange(roomStreams.At(index), count)];
+		grid.RemoveWall(index, randomSide);
 	}
 }
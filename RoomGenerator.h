@@ -1,31 +1,43 @@
 #pragma once
+#include <cstdint>
 #include <vector>
 #include <memory>
 
+#include "RandomStream.h"
+#include "World.h"
+
 namespace mazer
 {
 	class Room;
+	class MazeGrid;
 
 	class RoomGenerator
 	{
 	public:
 		RoomGenerator() = delete;
+		// A different maze each time it generates one
 		RoomGenerator(int screenWidth, int screenHeight, int rows, int columns, bool removeRandomSides);
+		RoomGenerator(int screenWidth, int screenHeight, int rows, int columns, bool removeRandomSides,
+			std::uint64_t seed);
+
+		void ConfigureWalls(MazeGrid& grid, int index, const bool& canRemoveWallAbove, const bool& canRemoveWallRight,
+			const bool& canRemoveWallBelow, const bool& canRemoveWallLeft) const;
+		void RemoveSidesRandomly(MazeGrid& grid, int index, const bool& canRemoveAbove, const bool& canRemoveRight,
+			const bool& canRemoveBelow, const bool& canRemoveLeft) const;
+
+		// Generates the walls of the maze only
+		[[nodiscard]] std::shared_ptr<MazeGrid> GenerateGrid() const;
 
-		void ConfigureRooms(const std::vector<std::shared_ptr<Room>>& rooms) const;
-		void ConfigureWalls(const std::shared_ptr<Room>& thisRoom, const bool& canRemoveWallAbove,
-			const std::vector<std::shared_ptr<Room>>& rooms, const std::shared_ptr<Room>& nextRoom,
-			const bool& canRemoveWallRight, const bool& canRemoveWallBelow, const bool& canRemoveWallLeft,
-			const int& prevIndex) const;
-		void RemoveSidesRandomly(const bool& canRemoveAbove, const std::shared_ptr<Room>& currentRoom,
-			const std::vector<std::shared_ptr<Room>>& rooms, const std::shared_ptr<Room>& nextRoom,
-			const bool& canRemoveRight, const bool& canRemoveBelow, const bool& canRemoveLeft,
-			const int& prevIndex) const;
+		// Creates a room view over each cell of the grid, in the given world
+		[[nodiscard]] std::vector<std::shared_ptr<Room>> CreateRooms(const std::shared_ptr<MazeGrid>& grid,
+			World& world = World::Default()) const;
 
 		[[nodiscard]] std::vector<std::shared_ptr<Room>> Generate() const;
 
 	private:
 		int screenWidth, screenHeight, rows, columns;
 		bool removeRandomSides;
+		bool noWalls; // read once from the settings, not once per room
+		RandomStream roomStreams; // the n-th number is the random choice for room n
 	};
 }
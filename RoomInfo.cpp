@@ -5,46 +5,60 @@
 
 namespace mazer
 {
-	RoomInfo::RoomInfo(const std::shared_ptr<Room>& room)
+	RoomInfo::RoomInfo(const std::shared_ptr<Room>& room, World& world) : world(&world)
 	{
 		TheRoom = room;
 		RoomIndex = room->GetRoomNumber();
 	}
 
-	std::shared_ptr<Room> RoomInfo::GetTopRoom() const
+	Room* RoomInfo::GetTopRoom() const
 	{
 		return GetAdjacentRoomTo(GetCurrentRoom(), gamelib::Side::Top);
 	}
 
-	std::shared_ptr<Room> RoomInfo::GetBottomRoom() const
+	Room* RoomInfo::GetBottomRoom() const
 	{
 		return GetAdjacentRoomTo(GetCurrentRoom(), gamelib::Side::Bottom);
 	}
 
-	std::shared_ptr<Room> RoomInfo::GetRightRoom() const
+	Room* RoomInfo::GetRightRoom() const
 	{
 		return GetAdjacentRoomTo(GetCurrentRoom(), gamelib::Side::Right);
 	}
 
-	std::shared_ptr<Room> RoomInfo::GetLeftRoom() const
+	Room* RoomInfo::GetLeftRoom() const
 	{
 		return GetAdjacentRoomTo(GetCurrentRoom(), gamelib::Side::Left);
 	}
 
-	std::shared_ptr<Room> RoomInfo::GetCurrentRoom() const
+	Room* RoomInfo::GetCurrentRoom() const
 	{
-		return GameData::Get()->GetRoomByIndex(RoomIndex);
+		return world->Data().GetRoom(RoomIndex);
 	}
 
-	std::shared_ptr<Room> RoomInfo::GetRoomByIndex(const int index)
+	Room* RoomInfo::GetRoomByIndex(const int index) const
 	{
-		return GameData::Get()->GetRoomByIndex(index);
+		return world->Data().GetRoom(index);
 	}
 
-	std::shared_ptr<Room> RoomInfo::GetAdjacentRoomTo(const std::shared_ptr<Room>& room, const gamelib::Side side)
+	Room* RoomInfo::GetAdjacentRoomTo(const Room* room, const gamelib::Side side) const
 	{
 		if (!room) { return nullptr; }
-		return GameData::Get()->GetRoomByIndex(room->GetNeighborIndex(side));
+		return world->Data().GetRoom(room->GetNeighborIndex(side));
+	}
+
+	bool RoomInfo::UpdateCurrentRoom(const int x, const int y)
+	{
+		// Staying inside the current room is the common case and needs no room lookup at all
+		const auto& gameData = world->Data();
+		const auto index = gameData.GetRoomLocator().GetRoomIndex(x, y);
+		if (index < 0 || index == RoomIndex) { return false; }
+
+		const auto room = gameData.GetRoomByIndex(index);
+		if (!room) { return false; }
+
+		SetCurrentRoom(room);
+		return true;
 	}
 
 	void RoomInfo::SetCurrentRoom(const std::shared_ptr<Room>& room)
@@ -1,26 +1,34 @@
 #pragma once
 #include <memory>
 #include "Room.h"
+#include "World.h"
 
 namespace mazer
 {
 	class RoomInfo
 	{
 	public:
-		explicit RoomInfo(const std::shared_ptr<Room>& room);
+		explicit RoomInfo(const std::shared_ptr<Room>& room, World& world = World::Default());
 
-		[[nodiscard]] std::shared_ptr<Room> GetTopRoom() const;
-		[[nodiscard]] std::shared_ptr<Room> GetBottomRoom() const;
-		[[nodiscard]] std::shared_ptr<Room> GetRightRoom() const;
-		[[nodiscard]] std::shared_ptr<Room> GetLeftRoom() const;
-		[[nodiscard]] std::shared_ptr<Room> GetCurrentRoom() const;
+		// Rooms are looked up in the room registry of the world's game data and stay valid while they are registered
+		[[nodiscard]] Room* GetTopRoom() const;
+		[[nodiscard]] Room* GetBottomRoom() const;
+		[[nodiscard]] Room* GetRightRoom() const;
+		[[nodiscard]] Room* GetLeftRoom() const;
+		[[nodiscard]] Room* GetCurrentRoom() const;
 
-		static std::shared_ptr<Room> GetRoomByIndex(int index);
-		static std::shared_ptr<Room> GetAdjacentRoomTo(const std::shared_ptr<Room>& room, gamelib::Side side);
+		[[nodiscard]] Room* GetRoomByIndex(int index) const;
+		[[nodiscard]] Room* GetAdjacentRoomTo(const Room* room, gamelib::Side side) const;
+		[[nodiscard]] World& GetWorld() const { return *world; }
 		void SetCurrentRoom(const std::shared_ptr<Room>& room);
 
+		// Moves to the room containing the position, returns true if the room changed
+		bool UpdateCurrentRoom(int x, int y);
+
 		std::shared_ptr<Room> TheRoom;
 		int RoomIndex = 0;
 
+	private:
+		World* world;
 	};
 }
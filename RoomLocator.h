@@ -0,0 +1,86 @@
+#pragma once
+#ifndef ROOMLOCATOR_H
+#define ROOMLOCATOR_H
+
+namespace mazer
+{
+	/**
+	 * \brief Finds the room at a position from the layout of the maze.
+	 *
+	 * Rooms are laid out row by row as equal squares, so the room at a position is
+	 * (y / squareHeight) * columns + x / squareWidth. This costs the same however many rooms there are, unlike asking
+	 * each room whether the position is inside it.
+	 */
+	class RoomLocator
+	{
+	public:
+		// Locates nothing until given a layout
+		RoomLocator() = default;
+
+		RoomLocator(const int rows, const int columns, const int squareWidth, const int squareHeight, const int originX = 0,
+			const int originY = 0)
+			: rows(rows), columns(columns), squareWidth(squareWidth), squareHeight(squareHeight), originX(originX),
+			  originY(originY)
+		{
+		}
+
+		[[nodiscard]] bool IsValid() const { return rows > 0 && columns > 0 && squareWidth > 0 && squareHeight > 0; }
+
+		// Index of the room containing the position, or -1 if the position is outside the maze
+		[[nodiscard]] int GetRoomIndex(const int x, const int y) const
+		{
+			if (!IsValid()) { return -1; }
+
+			const auto localX = x - originX;
+			const auto localY = y - originY;
+			if (localX < 0 || localY < 0) { return -1; }
+
+			const auto column = localX / squareWidth;
+			const auto row = localY / squareHeight;
+			if (column >= columns || row >= rows) { return -1; }
+
+			return row * columns + column;
+		}
+
+		// Calls the function with the index of each room a rectangle overlaps, row by row. Parts outside are skipped
+		template <typename Function>
+		void ForEachRoomOverlapping(const int x, const int y, const int width, const int height, Function function) const
+		{
+			if (!IsValid() || width <= 0 || height <= 0) { return; }
+
+			const auto localX = x - originX;
+			const auto localY = y - originY;
+			if (localX + width <= 0 || localY + height <= 0) { return; }
+			if (localX >= columns * squareWidth || localY >= rows * squareHeight) { return; }
+
+			const auto firstColumn = Clamp(localX / squareWidth, columns);
+			const auto lastColumn = Clamp((localX + width - 1) / squareWidth, columns);
+			const auto firstRow = Clamp(localY / squareHeight, rows);
+			const auto lastRow = Clamp((localY + height - 1) / squareHeight, rows);
+
+			for (auto row = firstRow; row <= lastRow; row++)
+			{
+				for (auto column = firstColumn; column <= lastColumn; column++) { function(row * columns + column); }
+			}
+		}
+
+		[[nodiscard]] int GetRows() const { return rows; }
+		[[nodiscard]] int GetColumns() const { return columns; }
+		[[nodiscard]] int GetSquareWidth() const { return squareWidth; }
+		[[nodiscard]] int GetSquareHeight() const { return squareHeight; }
+		[[nodiscard]] int GetOriginX() const { return originX; }
+		[[nodiscard]] int GetOriginY() const { return originY; }
+
+	private:
+		static int Clamp(const int value, const int count) { return value < 0 ? 0 : value >= count ? count - 1 : value; }
+
+		int rows = 0;
+		int columns = 0;
+		int squareWidth = 0;
+		int squareHeight = 0;
+		int originX = 0; // position of the top left corner of room 0
+		int originY = 0;
+	};
+}
+
+#endif
@@ -1,6 +1,6 @@
 #include "pch.h"
 #include "Rooms.h"
-#include <file/SettingsManager.h>
+#include "MazerSettings.h"
 #include <functional>
 
 #include "Room.h"
@@ -10,35 +10,14 @@ using namespace gamelib;
 namespace mazer
 {
 
-	void Rooms::ConfigureRooms(const int rows, const int columns, const std::vector<std::shared_ptr<Room>>& rooms)
+	void Rooms::ConfigureRooms(const std::vector<std::shared_ptr<Room>>& rooms)
 	{
-		const auto totalRooms = static_cast<int>(rooms.size());
+		// Neighbors are derived from the grid the rooms are views over, so only the walls need configuring
+		if (!MazerSettings::Get()->Grid.NoWalls) { return; }
 
-		// Setup room
-		for (auto i = 0; i < totalRooms; i++)
+		for (const auto& room : rooms)
 		{
-			const auto nextIndex = i + 1;
-			const auto prevIndex = i - 1;
-			const auto roomRow = static_cast<int>(ceil(i / columns));
-			const auto roomCol = i % columns;
-
-			// Prevent removing outer walls 
-			const auto canRemoveTopWall = roomRow >= 1 && roomRow <= (rows - 1);
-			const auto canRemoveBottomWall = roomRow >= 0 && roomRow < (rows - 1);
-			const auto canRemoveLeftWall = roomCol > 0 && roomCol <= (columns - 1);
-			const auto canRemoveRightWall = roomCol >= 0 && roomCol < (columns - 1);
-
-			// Calculate indexes of sorrounding/adjacent rooms
-			const auto roomIndexAbove = canRemoveTopWall ? (i - columns) : -1;
-			const auto roomIndexBelow = canRemoveBottomWall ? (i + columns) : -1;
-			const auto roomIndexLeft = canRemoveLeftWall ? prevIndex : -1;
-			const auto roomIndexRight = canRemoveRightWall ? nextIndex : -1;
-			const auto& thisRoom = rooms[i];
-			auto nextRoom = nextIndex == totalRooms ? nullptr : rooms[nextIndex];
-
-			thisRoom->SetSurroundingRooms(roomIndexAbove, roomIndexRight, roomIndexBelow, roomIndexLeft, rooms);
-
-			ConfigureWalls(thisRoom);
+			RemoveAllWalls(room);
 		}
 	}
 
@@ -60,7 +39,7 @@ namespace mazer
 
 	void Rooms::ConfigureWalls(const std::shared_ptr<Room>& thisRoom)
 	{
-		if (SettingsManager::Get()->GetBool("grid", "nowalls"))
+		if (MazerSettings::Get()->Grid.NoWalls)
 		{
 			RemoveAllWalls(thisRoom);
 		}
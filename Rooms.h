@@ -10,7 +10,7 @@ namespace mazer
 	class Rooms
 	{
 	public:
-		static void ConfigureRooms(int rows, int columns, const std::vector<std::shared_ptr<Room>>& rooms);
+		static void ConfigureRooms(const std::vector<std::shared_ptr<Room>>& rooms);
 		static void ConfigureWalls(const std::shared_ptr<Room>& thisRoom);
 		static void RemoveAllWalls(const std::shared_ptr<Room>& thisRoom);
 		static gamelib::Coordinate<int> CenterOfRoom(const std::shared_ptr<Room>& room, int yourWidth, int yourHeight);
@@ -6,10 +6,10 @@ namespace mazer
 	class SdlCollisionDetection
 	{
 	public:
+		// Only whether they overlap: the intersection itself is not worked out
 		static bool IsColliding(const SDL_Rect* bounds1, const SDL_Rect* bounds2)
 		{
-			SDL_Rect result;
-			return SDL_IntersectRect(bounds1, bounds2, &result);
+			return SDL_HasIntersection(bounds1, bounds2);
 		}
 	};
 }
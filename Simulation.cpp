@@ -0,0 +1,149 @@
+#include "Simulation.h"
+#include <chrono>
+#include <cppgamelib/character/Direction.h>
+#include <cppgamelib/events/ControllerMoveEvent.h>
+#include <cppgamelib/events/EventManager.h>
+
+#include "CharacterBuilder.h"
+#include "Enemy.h"
+#include "EnemySystem.h"
+#include "GameData.h"
+#include "GameDataManager.h"
+#include "JobSystem.h"
+#include "Level.h"
+#include "pickup.h"
+#include "Player.h"
+#include "RandomStream.h"
+#include "Room.h"
+#include "World.h"
+
+using namespace gamelib;
+
+namespace mazer
+{
+	Simulation::Simulation(std::shared_ptr<Level> level, const unsigned long tickMs)
+		: level(std::move(level)), world(this->level->GetWorld()), tickMs(tickMs)
+	{
+	}
+
+	Simulation::~Simulation() = default;
+
+	void Simulation::Load()
+	{
+		// The game data manager removes collected pickups and killed enemies from the game data
+		world.Manager().Initialize(false);
+
+		level->Load();
+
+		auto& gameData = world.Data();
+		for (const auto& room : level->Rooms) { gameData.AddRoom(room); }
+		for (const auto& pickup : level->Pickups) { gameData.AddPickup(pickup); }
+		for (const auto& enemy : level->Enemies) { gameData.AddEnemy(enemy); }
+		if (level->Player1 != nullptr) { gameData.SetPlayer(level->Player1); }
+
+		// Deliver the add-to-scene events raised while loading
+		world.Events().ProcessAllEvents();
+	}
+
+	std::shared_ptr<Player> Simulation::SpawnPlayer(const int spriteResourceId, const int roomNumber)
+	{
+		const auto room = world.Data().GetRoomByIndex(roomNumber);
+		if (room == nullptr) { return nullptr; }
+
+		level->Player1 = CharacterBuilder::BuildPlayer("Player1", room, spriteResourceId, "Simulation", world);
+		return level->Player1;
+	}
+
+	void Simulation::BatchEnemies()
+	{
+		if (enemySystem == nullptr) { enemySystem = std::make_unique<EnemySystem>(world); }
+
+		const auto& enemies = world.Data().Enemies();
+		for (const auto enemy : enemies)
+		{
+			if (enemy->GetEnemySystem() == nullptr) { enemySystem->Add(enemies.Lock(enemy->Handle)); }
+		}
+	}
+
+	Simulation::Input Simulation::RandomInput(const std::uint64_t seed, const int ticksPerDirection)
+	{
+		const auto stream = RandomStream(seed).Derive(RandomDomain::Input);
+		const auto period = static_cast<std::uint64_t>(ticksPerDirection > 0 ? ticksPerDirection : 1);
+
+		// Counter-based, so the direction on any tick is known without replaying the ticks before it
+		return [stream, period](const std::uint64_t tick)
+			{
+				static constexpr Direction directions[] = { Direction::None, Direction::Up, Direction::Down,
+					Direction::Left, Direction::Right };
+				return directions[RandomStream::ToRange(stream.At(tick / period), 5)];
+			};
+	}
+
+	void Simulation::Steer(const Direction direction)
+	{
+		if (direction == heldDirection) { return; }
+
+		const auto& gameData = world.Data();
+		const auto player = gameData.GetPlayer(gameData.GetPlayerHandle());
+		if (player == nullptr) { return; }
+
+		if (heldDirection != Direction::None)
+		{
+			player->SetDirectionKeyState(heldDirection, ControllerMoveEvent::KeyState::Released);
+		}
+		if (direction != Direction::None)
+		{
+			player->SetDirectionKeyState(direction, ControllerMoveEvent::KeyState::Pressed);
+		}
+		heldDirection = direction;
+	}
+
+	void Simulation::Tick()
+	{
+		if (input) { Steer(input(tick)); }
+
+		// Objects only raise events while updating, removals happen when the events are delivered afterwards
+		const auto& gameData = world.Data();
+		if (const auto player = gameData.GetPlayer(gameData.GetPlayerHandle())) { player->Update(tickMs); }
+		if (enemySystem != nullptr) { enemySystem->Update(tickMs, jobs); }
+		else { for (const auto enemy : gameData.Enemies()) { enemy->Update(tickMs); } }
+
+		// Pickups and rooms only update themselves, so any thread can update any of them
+		if (jobs != nullptr)
+		{
+			const auto& pickups = gameData.Pickups();
+			jobs->ParallelFor(pickups.size(), 64, [&](const std::size_t begin, const std::size_t end)
+				{
+					for (auto i = begin; i < end; i++) { pickups[i]->Update(tickMs); }
+				});
+
+			const auto& rooms = level->Rooms;
+			jobs->ParallelFor(rooms.size(), 1024, [&](const std::size_t begin, const std::size_t end)
+				{
+					for (auto i = begin; i < end; i++) { rooms[i]->Update(tickMs); }
+				});
+		}
+		else
+		{
+			for (const auto pickup : gameData.Pickups()) { pickup->Update(tickMs); }
+			for (const auto& room : level->Rooms) { room->Update(tickMs); }
+		}
+
+		world.Events().ProcessAllEvents();
+		tick++;
+	}
+
+	SimulationReport Simulation::Run(const std::uint64_t ticks)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		for (std::uint64_t i = 0; i < ticks; i++) { Tick(); }
+		if (enemySystem != nullptr) { enemySystem->Sync(); }
+		const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+		SimulationReport report;
+		report.Ticks = ticks;
+		report.SimulatedMs = ticks * tickMs;
+		report.Seconds = elapsed.count();
+		return report;
+	}
+}
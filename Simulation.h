@@ -0,0 +1,87 @@
+#pragma once
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <cppgamelib/character/Direction.h>
+
+namespace mazer
+{
+	class EnemySystem;
+	class JobSystem;
+	class Level;
+	class Player;
+	class World;
+
+	struct SimulationReport
+	{
+		std::uint64_t Ticks = 0;
+		std::uint64_t SimulatedMs = 0;
+		double Seconds = 0.0; // wall clock
+
+		[[nodiscard]] double TicksPerSecond() const { return Seconds > 0.0 ? static_cast<double>(Ticks) / Seconds : 0.0; }
+	};
+
+	/**
+	 * \brief Runs a level without a window or renderer.
+	 *
+	 * Every tick steers the player from the input, updates the player, enemies, pickups and rooms of the level's world
+	 * by a fixed timestep and then dispatches the events they raised. Nothing is drawn, so simulations can run on
+	 * machines without a display, for load testing, AI tuning and performance checks.
+	 */
+	class Simulation
+	{
+	public:
+		// The direction the player is steered in on a tick, None to release the direction keys
+		using Input = std::function<gamelib::Direction(std::uint64_t tick)>;
+
+		static constexpr unsigned long DefaultTickMs = 16;
+
+		explicit Simulation(std::shared_ptr<Level> level, unsigned long tickMs = DefaultTickMs);
+		~Simulation();
+		Simulation(const Simulation&) = delete;
+		Simulation& operator=(const Simulation&) = delete;
+
+		// Loads the level and registers its rooms and objects with the level's world
+		void Load();
+
+		// Levels without a player can be given one, with a sprite from the resources
+		std::shared_ptr<Player> SpawnPlayer(int spriteResourceId, int roomNumber = 0);
+
+		void SetInput(Input newInput) { input = std::move(newInput); }
+
+		// Moves the enemies in the game data in one batched pass per tick instead of updating each of them
+		void BatchEnemies();
+		[[nodiscard]] EnemySystem* GetEnemySystem() const { return enemySystem.get(); }
+
+		// Spreads the batched enemies, the pickups and the rooms over the threads of the jobs. Ticks give the same
+		// result as without them. The player, and enemies that are not batched, are still updated one at a time
+		void SetJobSystem(JobSystem* jobSystem) { jobs = jobSystem; }
+
+		// Reproducible random input: a new direction, or none, every ticksPerDirection ticks
+		static Input RandomInput(std::uint64_t seed, int ticksPerDirection = 30);
+
+		void Tick();
+		SimulationReport Run(std::uint64_t ticks);
+
+		[[nodiscard]] std::uint64_t GetTick() const { return tick; }
+		[[nodiscard]] unsigned long GetTickMs() const { return tickMs; }
+		[[nodiscard]] const std::shared_ptr<Level>& GetLevel() const { return level; }
+
+	private:
+		void Steer(gamelib::Direction direction);
+
+		std::shared_ptr<Level> level;
+		World& world;
+		unsigned long tickMs;
+		std::uint64_t tick = 0;
+		Input input;
+		gamelib::Direction heldDirection = gamelib::Direction::None;
+		std::unique_ptr<EnemySystem> enemySystem;
+		JobSystem* jobs = nullptr;
+	};
+}
+
+#endif
@@ -0,0 +1,158 @@
+#pragma once
+#ifndef SLOTMAP_H
+#define SLOTMAP_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace mazer
+{
+	/**
+	 * \brief Refers to an object in a SlotMap.
+	 *
+	 * A handle stays the same for as long as its object is in the map. Once the object is removed its slot's
+	 * generation changes, so the handle no longer finds anything, even after the slot is reused.
+	 */
+	struct SlotHandle
+	{
+		static constexpr std::uint32_t InvalidIndex = ~std::uint32_t{ 0 };
+
+		std::uint32_t Index = InvalidIndex;
+		std::uint32_t Generation = 0;
+
+		[[nodiscard]] bool IsValid() const { return Index != InvalidIndex; }
+		bool operator==(const SlotHandle& other) const { return Index == other.Index && Generation == other.Generation; }
+		bool operator!=(const SlotHandle& other) const { return !(*this == other); }
+	};
+
+	/**
+	 * \brief Objects addressed by generational handles, stored contiguously.
+	 *
+	 * Looking an object up by handle is two array reads and a generation compare: no hashing and no reference
+	 * counting. The objects themselves are kept in a dense array of pointers, so walking over all of them is a linear
+	 * scan that allocates nothing. Removing an object moves the last one into its place.
+	 *
+	 * The map does not own its objects. The pointers it hands out are valid while the object is in the map, so owners
+	 * remove objects before releasing them; objects released without being removed are detected by RemoveExpired.
+	 */
+	template <typename T>
+	class SlotMap
+	{
+	public:
+		using const_iterator = typename std::vector<T*>::const_iterator;
+
+		SlotHandle Insert(const std::shared_ptr<T>& object)
+		{
+			std::uint32_t index;
+			if (freeSlots.empty())
+			{
+				index = static_cast<std::uint32_t>(slots.size());
+				slots.push_back({});
+			}
+			else
+			{
+				index = freeSlots.back();
+				freeSlots.pop_back();
+			}
+
+			auto& slot = slots[index];
+			slot.Position = static_cast<std::uint32_t>(objects.size());
+			objects.push_back(object.get());
+			owners.push_back(object);
+			slotOf.push_back(index);
+
+			return { index, slot.Generation };
+		}
+
+		// Removes the object the handle refers to, returns false if the handle is stale
+		bool Remove(const SlotHandle handle)
+		{
+			if (!Contains(handle)) { return false; }
+
+			auto& slot = slots[handle.Index];
+			const auto position = slot.Position;
+			const auto last = static_cast<std::uint32_t>(objects.size()) - 1;
+
+			// Fill the hole with the last object
+			if (position != last)
+			{
+				objects[position] = objects[last];
+				owners[position] = std::move(owners[last]);
+				slotOf[position] = slotOf[last];
+				slots[slotOf[position]].Position = position;
+			}
+			objects.pop_back();
+			owners.pop_back();
+			slotOf.pop_back();
+
+			slot.Generation++;
+			freeSlots.push_back(handle.Index);
+			return true;
+		}
+
+		[[nodiscard]] bool Contains(const SlotHandle handle) const
+		{
+			// Freeing a slot changes its generation, so only handles to objects still in the map match
+			return handle.Index < slots.size() && slots[handle.Index].Generation == handle.Generation;
+		}
+
+		// The object the handle refers to, or null if it has been removed
+		[[nodiscard]] T* Get(const SlotHandle handle) const
+		{
+			return Contains(handle) ? objects[slots[handle.Index].Position] : nullptr;
+		}
+
+		// The object as a shared pointer, for callers that need to keep it
+		[[nodiscard]] std::shared_ptr<T> Lock(const SlotHandle handle) const
+		{
+			return Contains(handle) ? owners[slots[handle.Index].Position].lock() : nullptr;
+		}
+
+		// Removes the objects that were released without being removed
+		void RemoveExpired()
+		{
+			for (auto position = static_cast<int>(objects.size()) - 1; position >= 0; position--)
+			{
+				if (owners[position].expired())
+				{
+					const auto index = slotOf[position];
+					Remove({ index, slots[index].Generation });
+				}
+			}
+		}
+
+		void clear()
+		{
+			for (auto index : slotOf)
+			{
+				slots[index].Generation++;
+				freeSlots.push_back(index);
+			}
+			objects.clear();
+			owners.clear();
+			slotOf.clear();
+		}
+
+		[[nodiscard]] std::size_t size() const { return objects.size(); }
+		[[nodiscard]] bool empty() const { return objects.empty(); }
+		[[nodiscard]] T* operator[](const std::size_t position) const { return objects[position]; }
+		[[nodiscard]] const_iterator begin() const { return objects.begin(); }
+		[[nodiscard]] const_iterator end() const { return objects.end(); }
+
+	private:
+		struct Slot
+		{
+			std::uint32_t Position = 0; // of the object in the dense arrays, while the slot is in use
+			std::uint32_t Generation = 0;
+		};
+
+		std::vector<Slot> slots;
+		std::vector<std::uint32_t> freeSlots;
+		std::vector<T*> objects; // dense
+		std::vector<std::weak_ptr<T>> owners; // alongside objects, only to detect objects released without removal
+		std::vector<std::uint32_t> slotOf; // slot of each object in objects
+	};
+}
+
+#endif
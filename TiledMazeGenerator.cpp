@@ -0,0 +1,117 @@
+#include "TiledMazeGenerator.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "DisjointSet.h"
+#include "EllerMazeGenerator.h"
+#include "MazeGrid.h"
+#include "MazeGridRowSink.h"
+#include "RandomStream.h"
+
+namespace mazer
+{
+	namespace
+	{
+		// A seam between two neighboring tiles
+		struct Seam
+		{
+			int FirstTile;
+			int SecondTile;
+			bool IsVertical; // the tiles are side by side
+		};
+	}
+
+	TiledMazeGenerator::TiledMazeGenerator(const int rows, const int columns, const std::uint64_t seed,
+		const int tileRows, const int tileColumns)
+		: rows(rows), columns(columns), seed(seed)
+	{
+		this->tileRows = std::max(1, tileRows);
+		this->tileColumns = std::max(1, (tileColumns + MazeGrid::WordBits - 1) / MazeGrid::WordBits) * MazeGrid::WordBits;
+		tilesDown = (rows + this->tileRows - 1) / this->tileRows;
+		tilesAcross = (columns + this->tileColumns - 1) / this->tileColumns;
+	}
+
+	std::shared_ptr<MazeGrid> TiledMazeGenerator::GenerateGrid(const unsigned int threads) const
+	{
+		auto grid = std::make_shared<MazeGrid>(rows, columns);
+		Generate(*grid, threads);
+		return grid;
+	}
+
+	void TiledMazeGenerator::Generate(MazeGrid& grid, unsigned int threads) const
+	{
+		if (threads == 0) { threads = std::max(1u, std::thread::hardware_concurrency()); }
+		threads = std::min(threads, static_cast<unsigned int>(GetTileCount()));
+
+		// Workers take the next tile until there are none left. Which worker generates a tile does not matter
+		// because each tile's random stream depends only on its position.
+		std::atomic<int> nextTile{ 0 };
+		auto worker = [&]()
+		{
+			for (auto tile = nextTile++; tile < GetTileCount(); tile = nextTile++)
+			{
+				GenerateTile(grid, tile);
+			}
+		};
+
+		std::vector<std::thread> workers;
+		for (auto i = 1u; i < threads; i++) { workers.emplace_back(worker); }
+		worker();
+		for (auto& thread : workers) { thread.join(); }
+
+		StitchTiles(grid);
+		grid.MarkChanged();
+	}
+
+	void TiledMazeGenerator::GenerateTile(MazeGrid& grid, const int tile) const
+	{
+		const auto firstRow = tile / tilesAcross * tileRows;
+		const auto firstColumn = tile % tilesAcross * tileColumns;
+		const auto height = std::min(tileRows, rows - firstRow);
+		const auto width = std::min(tileColumns, columns - firstColumn);
+
+		MazeGridRowSink sink(grid, firstRow, firstColumn);
+		EllerMazeGenerator(height, width, RandomStream(seed).Derive(RandomDomain::Tiles, tile).GetKey()).Generate(sink);
+	}
+
+	void TiledMazeGenerator::StitchTiles(MazeGrid& grid) const
+	{
+		std::vector<Seam> seams;
+		for (auto tile = 0; tile < GetTileCount(); tile++)
+		{
+			const auto tileRow = tile / tilesAcross;
+			const auto tileColumn = tile % tilesAcross;
+			if (tileColumn < tilesAcross - 1) { seams.push_back({ tile, tile + 1, true }); }
+			if (tileRow < tilesDown - 1) { seams.push_back({ tile, tile + tilesAcross, false }); }
+		}
+
+		// Visit the seams in random order and open one wall in each seam that joins two unconnected parts of the
+		// maze: a spanning tree of tiles, each of which is itself a spanning tree of rooms
+		auto random = RandomStream(seed).Derive(RandomDomain::Seams);
+		random.Shuffle(seams.begin(), seams.end());
+
+		DisjointSet tiles(GetTileCount());
+		for (const auto& seam : seams)
+		{
+			if (!tiles.Union(seam.FirstTile, seam.SecondTile)) { continue; }
+
+			const auto firstRow = seam.FirstTile / tilesAcross * tileRows;
+			const auto firstColumn = seam.FirstTile % tilesAcross * tileColumns;
+
+			if (seam.IsVertical)
+			{
+				const auto height = std::min(tileRows, rows - firstRow);
+				const auto row = firstRow + random.NextInt(height);
+				grid.SetVerticalWall(row, firstColumn + tileColumns, false);
+			}
+			else
+			{
+				const auto width = std::min(tileColumns, columns - firstColumn);
+				const auto column = firstColumn + random.NextInt(width);
+				grid.SetHorizontalWall(firstRow + tileRows, column, false);
+			}
+		}
+	}
+}
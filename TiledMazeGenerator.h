@@ -0,0 +1,51 @@
+#pragma once
+#ifndef TILEDMAZEGENERATOR_H
+#define TILEDMAZEGENERATOR_H
+
+#include <cstdint>
+#include <memory>
+
+namespace mazer
+{
+	class MazeGrid;
+
+	/**
+	 * \brief Generates a perfect maze in parallel by splitting the grid into tiles.
+	 *
+	 * Each tile is generated as a perfect maze on a worker thread with its own random stream, then the tiles are
+	 * joined by opening exactly one wall on the seams chosen by a union-find pass over the tiles, so the whole maze
+	 * stays perfect. The maze only depends on the seed and the tile size, never on the number of threads.
+	 */
+	class TiledMazeGenerator
+	{
+	public:
+		static constexpr int DefaultTileRows = 64;
+		static constexpr int DefaultTileColumns = 64;
+
+		// Tile columns are rounded up to a multiple of MazeGrid::WordBits so that no two tiles share a word of the grid
+		TiledMazeGenerator(int rows, int columns, std::uint64_t seed, int tileRows = DefaultTileRows,
+			int tileColumns = DefaultTileColumns);
+
+		// Generates into the grid, which must be fully walled. Zero threads means one per hardware thread.
+		void Generate(MazeGrid& grid, unsigned int threads = 0) const;
+		[[nodiscard]] std::shared_ptr<MazeGrid> GenerateGrid(unsigned int threads = 0) const;
+
+		[[nodiscard]] int GetTileRows() const { return tileRows; }
+		[[nodiscard]] int GetTileColumns() const { return tileColumns; }
+		[[nodiscard]] int GetTileCount() const { return tilesDown * tilesAcross; }
+
+	private:
+		void GenerateTile(MazeGrid& grid, int tile) const;
+		void StitchTiles(MazeGrid& grid) const;
+
+		int rows;
+		int columns;
+		std::uint64_t seed;
+		int tileRows;
+		int tileColumns;
+		int tilesDown;
+		int tilesAcross;
+	};
+}
+
+#endif
@@ -0,0 +1,44 @@
+#include "World.h"
+#include <cppgamelib/events/EventManager.h>
+#include "GameData.h"
+#include "GameDataManager.h"
+#include "PooledEvents.h"
+
+namespace mazer
+{
+	World::World(gamelib::EventManager* eventManager)
+		: data(std::make_unique<GameData>()), eventManager(eventManager), pools(std::make_unique<PooledEvents>())
+	{
+		manager = std::make_unique<GameDataManager>(data.get(), eventManager);
+	}
+
+	World::World(DefaultTag) : pools(std::make_unique<PooledEvents>()) {}
+
+	World::~World() = default;
+
+	World& World::Default()
+	{
+		static World world{ DefaultTag{} };
+		return world;
+	}
+
+	GameData& World::Data() const
+	{
+		return data != nullptr ? *data : *GameData::Get();
+	}
+
+	GameDataManager& World::Manager() const
+	{
+		return manager != nullptr ? *manager : *GameDataManager::Get();
+	}
+
+	gamelib::EventManager& World::Events() const
+	{
+		return eventManager != nullptr ? *eventManager : *gamelib::EventManager::Get();
+	}
+
+	PooledEvents& World::Pools() const
+	{
+		return *pools;
+	}
+}
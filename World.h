@@ -0,0 +1,56 @@
+#pragma once
+#ifndef WORLD_H
+#define WORLD_H
+
+#include <memory>
+
+namespace gamelib
+{
+	class EventManager;
+}
+
+namespace mazer
+{
+	class GameData;
+	class GameDataManager;
+	class PooledEvents;
+
+	/**
+	 * \brief One maze: the game data holding its rooms, objects and player, the manager keeping that data up to date
+	 * and the event manager its objects raise events on, with pools of the events they raise most.
+	 *
+	 * Worlds do not share game data, so a process can run several of them, for example one per thread for headless
+	 * matches. The default world is the GameData and GameDataManager singletons, for code that is not given a world.
+	 */
+	class World final
+	{
+	public:
+		// A world with game data of its own. Events go to the given event manager, or the shared one if null
+		explicit World(gamelib::EventManager* eventManager = nullptr);
+		~World();
+		World(const World&) = delete;
+		World(const World&&) = delete;
+		World& operator=(const World&) = delete;
+		World& operator=(const World&&) = delete;
+
+		// The world of the singletons
+		static World& Default();
+
+		[[nodiscard]] GameData& Data() const;
+		[[nodiscard]] GameDataManager& Manager() const;
+		[[nodiscard]] gamelib::EventManager& Events() const;
+		[[nodiscard]] PooledEvents& Pools() const;
+
+	private:
+		struct DefaultTag {};
+		explicit World(DefaultTag);
+
+		// Null in the default world, which always finds the current singletons
+		std::unique_ptr<GameData> data;
+		std::unique_ptr<GameDataManager> manager;
+		gamelib::EventManager* eventManager = nullptr;
+		std::unique_ptr<PooledEvents> pools;
+	};
+}
+
+#endif
@@ -0,0 +1,267 @@
+#include "XmlStreamReader.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+
+namespace mazer
+{
+	namespace
+	{
+		bool IsSpace(const char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+
+		char* SkipSpaces(char* position, const char* last)
+		{
+			while (position < last && IsSpace(*position)) { position++; }
+			return position;
+		}
+
+		// Replaces the predefined entities in place, returns the new end. The decoded text is never longer.
+		char* DecodeEntities(char* first, char* last)
+		{
+			static constexpr std::pair<std::string_view, char> entities[] =
+			{
+				{ "&amp;", '&' }, { "&lt;", '<' }, { "&gt;", '>' }, { "&quot;", '"' }, { "&apos;", '\'' }
+			};
+
+			auto* output = first;
+			for (auto* input = first; input < last;)
+			{
+				if (*input == '&')
+				{
+					const auto rest = std::string_view(input, static_cast<std::size_t>(last - input));
+					const auto* entity = std::find_if(std::begin(entities), std::end(entities),
+						[&](const auto& candidate) { return rest.substr(0, candidate.first.size()) == candidate.first; });
+
+					if (entity != std::end(entities))
+					{
+						*output++ = entity->second;
+						input += entity->first.size();
+						continue;
+					}
+				}
+				*output++ = *input++;
+			}
+			return output;
+		}
+
+		// Finds the end of the tag that starts at first, or null if it is not in the buffer yet
+		char* FindTagEnd(char* first, char* last)
+		{
+			const auto text = std::string_view(first, static_cast<std::size_t>(last - first));
+			auto findEnd = [&](const std::string_view terminator) -> char*
+			{
+				const auto position = text.find(terminator, 1);
+				return position == std::string_view::npos ? nullptr : first + position + terminator.size() - 1;
+			};
+
+			if (text.substr(0, 4) == "<!--") { return findEnd("-->"); }
+			if (text.substr(0, 9) == "<![CDATA[") { return findEnd("]]>"); }
+			if (text.size() < 9 && std::string_view("<![CDATA[").substr(0, text.size()) == text) { return nullptr; }
+			if (text.substr(0, 2) == "<?") { return findEnd("?>"); }
+
+			// A '>' inside an attribute value does not end the tag
+			char quote = 0;
+			for (auto* position = first + 1; position < last; position++)
+			{
+				if (quote != 0) { if (*position == quote) { quote = 0; } }
+				else if (*position == '"' || *position == '\'') { quote = *position; }
+				else if (*position == '>') { return position; }
+			}
+			return nullptr;
+		}
+	}
+
+	std::string_view XmlAttributes::Get(const std::string_view name) const
+	{
+		for (const auto& [attributeName, value] : attributes)
+		{
+			if (attributeName == name) { return value; }
+		}
+		return {};
+	}
+
+	bool XmlAttributes::Has(const std::string_view name) const
+	{
+		return std::any_of(attributes.begin(), attributes.end(), [name](const auto& attribute) { return attribute.first == name; });
+	}
+
+	int XmlAttributes::GetInt(const std::string_view name, const int defaultValue) const
+	{
+		const auto value = Get(name);
+		auto result = defaultValue;
+		std::from_chars(value.data(), value.data() + value.size(), result);
+		return result;
+	}
+
+	std::uint64_t XmlAttributes::GetUnsigned64(const std::string_view name, const std::uint64_t defaultValue) const
+	{
+		const auto value = Get(name);
+		auto result = defaultValue;
+		std::from_chars(value.data(), value.data() + value.size(), result);
+		return result;
+	}
+
+	bool XmlAttributes::GetBool(const std::string_view name, const bool defaultValue) const
+	{
+		const auto value = Get(name);
+		if (value.size() == 4 && std::equal(value.begin(), value.end(), "true",
+			[](const char a, const char b) { return std::tolower(static_cast<unsigned char>(a)) == b; }))
+		{
+			return true;
+		}
+		return Has(name) ? false : defaultValue;
+	}
+
+	XmlStreamReader::XmlStreamReader(const std::size_t chunkSize) : chunkSize(std::max<std::size_t>(chunkSize, 16))
+	{
+	}
+
+	bool XmlStreamReader::ParseFile(const std::string& fileName, IXmlStreamHandler& handler)
+	{
+		std::ifstream input(fileName, std::ios::binary);
+		if (!input) { return Fail("Cannot open " + fileName); }
+
+		return Parse(input, handler);
+	}
+
+	bool XmlStreamReader::Parse(std::istream& input, IXmlStreamHandler& handler)
+	{
+		error.clear();
+		bytesRead = 0;
+		buffer.resize(chunkSize);
+
+		std::size_t begin = 0; // first unprocessed character
+		std::size_t end = 0; // end of the characters read so far
+		auto isEndOfInput = false;
+		auto isStart = true;
+
+		while (true)
+		{
+			auto* first = buffer.data() + begin;
+			auto* last = buffer.data() + end;
+
+			// Skip text up to the next tag
+			auto* tag = static_cast<char*>(std::memchr(first, '<', static_cast<std::size_t>(last - first)));
+			char* tagEnd = nullptr;
+
+			if (tag != nullptr)
+			{
+				tagEnd = FindTagEnd(tag, last);
+				begin = static_cast<std::size_t>(tag - buffer.data());
+			}
+			else
+			{
+				begin = end;
+			}
+
+			if (tagEnd != nullptr)
+			{
+				if (!ParseTag(tag, tagEnd, handler)) { return false; }
+				begin = static_cast<std::size_t>(tagEnd + 1 - buffer.data());
+				continue;
+			}
+
+			if (isEndOfInput)
+			{
+				return tag == nullptr ? true : Fail("Unterminated tag at end of input");
+			}
+
+			// Keep the incomplete tag, make room for more input and grow the buffer if one tag fills it
+			std::memmove(buffer.data(), buffer.data() + begin, end - begin);
+			end -= begin;
+			begin = 0;
+			if (end == buffer.size()) { buffer.resize(buffer.size() * 2); }
+
+			input.read(buffer.data() + end, static_cast<std::streamsize>(buffer.size() - end));
+			const auto count = static_cast<std::size_t>(input.gcount());
+			isEndOfInput = count == 0;
+			bytesRead += count;
+
+			// Skip the UTF-8 byte order mark
+			if (isStart && count > 0)
+			{
+				isStart = false;
+				if (count >= 3 && std::memcmp(buffer.data(), "\xEF\xBB\xBF", 3) == 0) { begin = 3; }
+			}
+
+			end += count;
+		}
+	}
+
+	bool XmlStreamReader::ParseTag(char* first, char* last, IXmlStreamHandler& handler)
+	{
+		// Comments, processing instructions, CDATA and DOCTYPE
+		if (first[1] == '!' || first[1] == '?') { return true; }
+
+		if (first[1] == '/')
+		{
+			auto* nameStart = SkipSpaces(first + 2, last);
+			auto* nameEnd = nameStart;
+			while (nameEnd < last && !IsSpace(*nameEnd)) { nameEnd++; }
+			if (nameEnd == nameStart) { return Fail("End tag without a name"); }
+
+			handler.OnEndElement(std::string_view(nameStart, static_cast<std::size_t>(nameEnd - nameStart)));
+			return true;
+		}
+
+		const auto isSelfClosing = last[-1] == '/';
+		auto* tagContentEnd = isSelfClosing ? last - 1 : last;
+
+		auto* nameEnd = first + 1;
+		while (nameEnd < tagContentEnd && !IsSpace(*nameEnd)) { nameEnd++; }
+		if (nameEnd == first + 1) { return Fail("Tag without a name"); }
+
+		const auto name = std::string_view(first + 1, static_cast<std::size_t>(nameEnd - first - 1));
+		if (!ParseAttributes(nameEnd, tagContentEnd)) { return false; }
+
+		handler.OnStartElement(name, attributes);
+		if (isSelfClosing) { handler.OnEndElement(name); }
+		return true;
+	}
+
+	bool XmlStreamReader::ParseAttributes(char* position, char* last)
+	{
+		attributes.attributes.clear();
+
+		while ((position = SkipSpaces(position, last)) < last)
+		{
+			auto* nameStart = position;
+			while (position < last && *position != '=' && !IsSpace(*position)) { position++; }
+			auto* nameEnd = position;
+
+			position = SkipSpaces(position, last);
+			if (position == last || *position != '=' || nameEnd == nameStart)
+			{
+				return Fail("Malformed attribute " + std::string(nameStart, nameEnd));
+			}
+
+			position = SkipSpaces(position + 1, last);
+			if (position == last || (*position != '"' && *position != '\''))
+			{
+				return Fail("Unquoted value for attribute " + std::string(nameStart, nameEnd));
+			}
+
+			const auto quote = *position++;
+			auto* valueStart = position;
+			while (position < last && *position != quote) { position++; }
+			if (position == last) { return Fail("Unterminated value for attribute " + std::string(nameStart, nameEnd)); }
+
+			auto* valueEnd = std::memchr(valueStart, '&', static_cast<std::size_t>(position - valueStart)) != nullptr
+				? DecodeEntities(valueStart, position)
+				: position;
+
+			attributes.attributes.emplace_back(std::string_view(nameStart, static_cast<std::size_t>(nameEnd - nameStart)),
+				std::string_view(valueStart, static_cast<std::size_t>(valueEnd - valueStart)));
+			position++;
+		}
+		return true;
+	}
+
+	bool XmlStreamReader::Fail(const std::string& message)
+	{
+		error = message;
+		return false;
+	}
+}
@@ -0,0 +1,84 @@
+#pragma once
+#ifndef XMLSTREAMREADER_H
+#define XMLSTREAMREADER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace mazer
+{
+	// The attributes of an element. Names and values point into the reader's buffer and are only valid during the
+	// callback they are passed to.
+	class XmlAttributes
+	{
+	public:
+		// Empty if the element has no such attribute
+		[[nodiscard]] std::string_view Get(std::string_view name) const;
+		[[nodiscard]] bool Has(std::string_view name) const;
+
+		[[nodiscard]] int GetInt(std::string_view name, int defaultValue = 0) const;
+		[[nodiscard]] std::uint64_t GetUnsigned64(std::string_view name, std::uint64_t defaultValue = 0) const;
+
+		// "True" and "true" are true, case does not matter
+		[[nodiscard]] bool GetBool(std::string_view name, bool defaultValue = false) const;
+
+		[[nodiscard]] std::size_t GetCount() const { return attributes.size(); }
+		[[nodiscard]] const std::pair<std::string_view, std::string_view>& operator[](const std::size_t index) const { return attributes[index]; }
+
+	private:
+		friend class XmlStreamReader;
+		std::vector<std::pair<std::string_view, std::string_view>> attributes;
+	};
+
+	class IXmlStreamHandler
+	{
+	public:
+		virtual ~IXmlStreamHandler() = default;
+		virtual void OnStartElement(std::string_view name, const XmlAttributes& attributes) = 0;
+
+		// Also called straight after OnStartElement for self-closing elements
+		virtual void OnEndElement([[maybe_unused]] std::string_view name) {}
+	};
+
+	/**
+	 * \brief Reads XML a chunk at a time and reports elements as they are read.
+	 *
+	 * No document is built: memory use is bounded by the chunk size (or the largest tag, if bigger) whatever the
+	 * size of the input. Text content, comments, processing instructions and DOCTYPE are skipped. Attribute values
+	 * have the predefined entities decoded.
+	 */
+	class XmlStreamReader
+	{
+	public:
+		static constexpr std::size_t DefaultChunkSize = 64 * 1024;
+
+		explicit XmlStreamReader(std::size_t chunkSize = DefaultChunkSize);
+
+		// Returns false if the XML is malformed or the file cannot be opened. Elements read before an error have
+		// already been reported to the handler.
+		bool Parse(std::istream& input, IXmlStreamHandler& handler);
+		bool ParseFile(const std::string& fileName, IXmlStreamHandler& handler);
+
+		[[nodiscard]] const std::string& GetError() const { return error; }
+		[[nodiscard]] std::uint64_t GetBytesRead() const { return bytesRead; }
+
+	private:
+		// Handles the tag in [first, last], returns false if it is malformed
+		bool ParseTag(char* first, char* last, IXmlStreamHandler& handler);
+		bool ParseAttributes(char* position, char* last);
+		bool Fail(const std::string& message);
+
+		std::size_t chunkSize;
+		std::vector<char> buffer;
+		XmlAttributes attributes;
+		std::string error;
+		std::uint64_t bytesRead = 0;
+	};
+}
+
+#endif
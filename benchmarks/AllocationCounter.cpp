@@ -0,0 +1,34 @@
+#include "AllocationCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+	std::atomic<std::size_t> allocatedBytes{ 0 };
+	std::atomic<std::size_t> allocationCount{ 0 };
+}
+
+void* operator new(const std::size_t size)
+{
+	allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+	if (auto* memory = std::malloc(size == 0 ? 1 : size)) { return memory; }
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+
+namespace mazer::benchmarks
+{
+	void AllocationCounter::Reset()
+	{
+		allocatedBytes = 0;
+		allocationCount = 0;
+	}
+
+	std::size_t AllocationCounter::GetBytes() { return allocatedBytes; }
+	std::size_t AllocationCounter::GetCount() { return allocationCount; }
+}
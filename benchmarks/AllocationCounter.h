@@ -0,0 +1,15 @@
+#pragma once
+#include <cstddef>
+
+namespace mazer::benchmarks
+{
+	// Counts heap allocations made through the global operator new, so benchmarks can report memory use and tests
+	// can check that nothing is allocated
+	class AllocationCounter
+	{
+	public:
+		static void Reset();
+		static std::size_t GetBytes();
+		static std::size_t GetCount();
+	};
+}
@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vector>
+#include <SDL.h>
+
+#include "BatchCollisionDetection.h"
+#include "RandomStream.h"
+
+using namespace mazer;
+
+namespace
+{
+	constexpr auto Seed = 1234u;
+	constexpr SDL_Rect Player = { 500, 500, 24, 24 };
+
+	// Enemy sized rectangles over a 1024 x 1024 area, as one rectangle each and as columns
+	struct Crowd
+	{
+		explicit Crowd(const int count)
+		{
+			RandomStream random(Seed);
+			for (auto i = 0; i < count; i++)
+			{
+				const SDL_Rect rect = { random.NextInt(1024), random.NextInt(1024), 24, 24 };
+				Rects.push_back(rect);
+				Xs.push_back(rect.x);
+				Ys.push_back(rect.y);
+				Widths.push_back(rect.w);
+				Heights.push_back(rect.h);
+			}
+		}
+
+		[[nodiscard]] BoundsColumns Columns() const { return { Xs.data(), Ys.data(), Widths.data(), Heights.data() }; }
+
+		std::vector<SDL_Rect> Rects;
+		std::vector<int> Xs;
+		std::vector<int> Ys;
+		std::vector<int> Widths;
+		std::vector<int> Heights;
+	};
+}
+
+// One SDL_IntersectRect per rectangle, working out each intersection, as the collision checks used to
+static void BM_SdlIntersectRect(benchmark::State& state)
+{
+	const Crowd crowd(static_cast<int>(state.range(0)));
+
+	for (auto _ : state)
+	{
+		auto hits = 0;
+		for (const auto& rect : crowd.Rects)
+		{
+			SDL_Rect result;
+			hits += SDL_IntersectRect(&Player, &rect, &result) ? 1 : 0;
+		}
+		benchmark::DoNotOptimize(hits);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SdlIntersectRect)->Arg(4096)->Arg(65536);
+
+static void BM_SdlHasIntersection(benchmark::State& state)
+{
+	const Crowd crowd(static_cast<int>(state.range(0)));
+
+	for (auto _ : state)
+	{
+		auto hits = 0;
+		for (const auto& rect : crowd.Rects) { hits += SDL_HasIntersection(&Player, &rect) ? 1 : 0; }
+		benchmark::DoNotOptimize(hits);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SdlHasIntersection)->Arg(4096)->Arg(65536);
+
+// The batch kernels: 0 plain C++, 1 SSE2, 2 AVX2. Kernels the processor lacks are skipped
+static void BM_BatchOverlaps(benchmark::State& state)
+{
+	const auto kernel = static_cast<BatchCollisionDetection::Kernel>(state.range(1));
+	if (!BatchCollisionDetection::IsSupported(kernel))
+	{
+		state.SkipWithError("Kernel not supported by this processor");
+		return;
+	}
+
+	const auto count = static_cast<std::size_t>(state.range(0));
+	const Crowd crowd(static_cast<int>(count));
+	const auto columns = crowd.Columns();
+
+	for (auto _ : state)
+	{
+		std::uint64_t hits = 0;
+		for (std::size_t first = 0; first < count; first += BatchCollisionDetection::MaxBatch)
+		{
+			hits ^= BatchCollisionDetection::Overlaps(Player, columns, first, BatchCollisionDetection::MaxBatch, kernel);
+		}
+		benchmark::DoNotOptimize(hits);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BatchOverlaps)->ArgsProduct({ { 4096, 65536 }, { 0, 1, 2 } });
@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "GameObjectRegistry.h"
+
+using namespace mazer;
+
+namespace
+{
+	struct Object
+	{
+		explicit Object(const int id) : Id(id) {}
+		int Id;
+	};
+
+	std::vector<std::shared_ptr<Object>> MakeObjects(const int count)
+	{
+		std::vector<std::shared_ptr<Object>> objects;
+		objects.reserve(count);
+		for (auto i = 0; i < count; i++) { objects.push_back(std::make_shared<Object>(i)); }
+		return objects;
+	}
+}
+
+// Adding and then removing every object the way GameData used to: a scan of the list on each add and remove
+static void BM_AddRemoveByScanning(benchmark::State& state)
+{
+	const auto objects = MakeObjects(static_cast<int>(state.range(0)));
+
+	for (auto _ : state)
+	{
+		std::vector<std::weak_ptr<Object>> list;
+		auto isSameId = [](const std::weak_ptr<Object>& entry, const std::shared_ptr<Object>& other)
+		{
+			return !entry.expired() && entry.lock()->Id == other->Id;
+		};
+
+		for (const auto& object : objects)
+		{
+			if (std::find_if(list.begin(), list.end(), [&](const auto& entry) { return isSameId(entry, object); }) == list.end())
+			{
+				list.push_back(object);
+			}
+		}
+		for (const auto& object : objects)
+		{
+			list.erase(std::remove_if(list.begin(), list.end(), [&](const auto& entry) { return isSameId(entry, object); }), list.end());
+		}
+		benchmark::DoNotOptimize(list.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AddRemoveByScanning)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+static void BM_AddRemoveByRegistry(benchmark::State& state)
+{
+	const auto objects = MakeObjects(static_cast<int>(state.range(0)));
+
+	for (auto _ : state)
+	{
+		GameObjectRegistry<Object> registry;
+		for (const auto& object : objects) { registry.Add(object->Id, object); }
+		for (const auto& object : objects) { registry.Remove(object->Id); }
+		benchmark::DoNotOptimize(registry.size());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AddRemoveByRegistry)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
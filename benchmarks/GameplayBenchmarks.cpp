@@ -0,0 +1,336 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cppgamelib/events/EventFactory.h>
+#include <cppgamelib/events/EventManager.h>
+#include <cppgamelib/resource/ResourceManager.h>
+
+#include "CharacterBuilder.h"
+#include "Enemy.h"
+#include "EnemyMovedEvent.h"
+#include "EnemySystem.h"
+#include "GameData.h"
+#include "GameObjectMoveStrategy.h"
+#include "JobSystem.h"
+#include "Level.h"
+#include "MazeGrid.h"
+#include "MazerSettings.h"
+#include "pickup.h"
+#include "Player.h"
+#include "PooledEvents.h"
+#include "RandomStream.h"
+#include "RoomGenerator.h"
+#include "RoomInfo.h"
+#include "Simulation.h"
+#include "World.h"
+
+using namespace mazer;
+
+namespace
+{
+	constexpr auto Seed = 1234u;
+	constexpr auto PlayerResourceId = 188;
+	constexpr auto EnemyResourceId = 18;
+
+	constexpr gamelib::Direction Directions[] = { gamelib::Direction::Up, gamelib::Direction::Right,
+		gamelib::Direction::Down, gamelib::Direction::Left };
+
+	// A world holding a generated size x size maze with the player in the middle
+	class Maze
+	{
+	public:
+		explicit Maze(const int size) : Size(size)
+		{
+			gamelib::ResourceManager::Get()->Initialize("Resources.xml");
+
+			const RoomGenerator generator(size * 32, size * 32, size, size, true, Seed);
+			Rooms = generator.CreateRooms(generator.GenerateGrid(), TheWorld);
+			for (const auto& room : Rooms) { TheWorld.Data().AddRoom(room); }
+
+			TheLevel = std::make_shared<Level>(TheWorld);
+			ThePlayer = CharacterBuilder::BuildPlayer("Player", Rooms[Middle(size)], PlayerResourceId, "Benchmark", TheWorld);
+		}
+
+		~Maze() { gamelib::EventManager::Get()->Reset(); }
+		Maze(const Maze&) = delete;
+		Maze& operator=(const Maze&) = delete;
+
+		static int Middle(const int size) { return size / 2 * size + size / 2; }
+
+		// Enemies in random rooms, registered with the game data
+		std::vector<std::shared_ptr<Enemy>> SpawnEnemies(const int count)
+		{
+			RandomStream random(Seed);
+			std::vector<std::shared_ptr<Enemy>> enemies;
+			for (auto i = 0; i < count; i++)
+			{
+				// Away from the player, so that no enemy is killed by touching it
+				auto room = random.NextInt(Size * Size);
+				if (room == Middle(Size)) { room = 0; }
+
+				auto enemy = CharacterBuilder::BuildEnemy("Enemy", Rooms[room], EnemyResourceId, Directions[i & 3],
+					TheLevel, TheWorld);
+				enemy->Initialize();
+				TheWorld.Data().AddEnemy(enemy);
+				enemies.push_back(enemy);
+			}
+			return enemies;
+		}
+
+		int Size;
+		World TheWorld;
+		std::vector<std::shared_ptr<Room>> Rooms;
+		std::shared_ptr<Level> TheLevel;
+		std::shared_ptr<Player> ThePlayer;
+	};
+}
+
+static void BM_CanGameObjectMove(benchmark::State& state)
+{
+	Maze maze(static_cast<int>(state.range(0)));
+	GameObjectMoveStrategy strategy(maze.ThePlayer, maze.ThePlayer->CurrentRoom);
+	auto step = 0;
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(strategy.CanGameObjectMove(Directions[step++ & 3]));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CanGameObjectMove)->Arg(10)->Arg(100);
+
+// A player stepping back and forth and asking about every direction each step, as Player::Update does. The
+// permissions are worked out once per step and the other questions read them
+static void BM_MovePermissionsWhileMoving(benchmark::State& state)
+{
+	Maze maze(static_cast<int>(state.range(0)));
+	GameObjectMoveStrategy strategy(maze.ThePlayer, maze.ThePlayer->CurrentRoom);
+	auto step = 0;
+
+	for (auto _ : state)
+	{
+		maze.ThePlayer->Bounds.x += (step++ & 1) != 0 ? 1 : -1;
+		for (const auto direction : Directions) { benchmark::DoNotOptimize(strategy.CanGameObjectMove(direction)); }
+		benchmark::DoNotOptimize(strategy.GetMovePermissions());
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MovePermissionsWhileMoving)->Arg(10)->Arg(100);
+
+// An enemy in the corner looking across the whole maze, along corridors of every length
+static void BM_IsPlayerInLineOfSight(benchmark::State& state)
+{
+	const auto size = static_cast<int>(state.range(0));
+	Maze maze(size);
+	const auto enemy = CharacterBuilder::BuildEnemy("Enemy", maze.Rooms[0], EnemyResourceId, gamelib::Direction::Down,
+		maze.TheLevel, maze.TheWorld);
+	auto step = 0;
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(enemy->IsPlayerInLineOfSight(Directions[step++ & 3]));
+	}
+	state.counters["rooms"] = size * size;
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_IsPlayerInLineOfSight)->Arg(10)->Arg(100)->Arg(1000);
+
+// A player moved event reaching a pickup in another room (0) or colliding with the player (1)
+static void BM_PickupHandlePlayerMoved(benchmark::State& state)
+{
+	const auto colliding = state.range(0) != 0;
+	Maze maze(10);
+	const auto room = colliding ? maze.Rooms[Maze::Middle(10)] : maze.Rooms[0];
+	const auto pickup = CharacterBuilder::BuildPickup("Pickup", room, PlayerResourceId, maze.TheWorld);
+	const auto event = gamelib::EventFactory::Get()->CreatePlayerMovedEvent(gamelib::Direction::Up);
+
+	for (auto _ : state)
+	{
+		auto events = pickup->HandleEvent(event, 0);
+		benchmark::DoNotOptimize(events.data());
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PickupHandlePlayerMoved)->Arg(0)->Arg(1);
+
+// A player step in a size x size maze with a pickup in every room but the player's: only the pickups in the rooms the player
+// overlaps are looked at, so the time should not grow with the size of the maze
+static void BM_PlayerStepAmongPickups(benchmark::State& state)
+{
+	const auto size = static_cast<int>(state.range(0));
+	Maze maze(size);
+	std::vector<std::shared_ptr<Pickup>> pickups;
+	for (auto room = 0; room < size * size; room++)
+	{
+		if (room == Maze::Middle(size)) { continue; }
+		pickups.push_back(CharacterBuilder::BuildPickup("Pickup", maze.Rooms[room], PlayerResourceId, maze.TheWorld));
+		maze.TheWorld.Data().AddPickup(pickups.back());
+	}
+
+	// Back and forth inside the middle room, one move per update
+	const auto moveRateMs = static_cast<unsigned long>(std::max(1, MazerSettings::Get()->Enemy.MoveRateMs));
+	auto step = 0;
+	for (auto _ : state)
+	{
+		const auto direction = (step++ & 1) != 0 ? gamelib::Direction::Left : gamelib::Direction::Right;
+		maze.ThePlayer->SetDirectionKeyState(direction, gamelib::ControllerMoveEvent::KeyState::Pressed);
+		maze.ThePlayer->Update(moveRateMs);
+		maze.ThePlayer->SetDirectionKeyState(direction, gamelib::ControllerMoveEvent::KeyState::Released);
+		maze.TheWorld.Events().ProcessAllEvents();
+	}
+
+	state.counters["pickups"] = static_cast<double>(pickups.size());
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PlayerStepAmongPickups)->Arg(10)->Arg(100)->Arg(300);
+
+static void BM_GameDataAddRemove(benchmark::State& state)
+{
+	const auto count = static_cast<int>(state.range(0));
+	Maze maze(10);
+	std::vector<std::shared_ptr<Pickup>> pickups;
+	std::vector<std::shared_ptr<Enemy>> enemies;
+	for (auto i = 0; i < count; i++)
+	{
+		const auto& room = maze.Rooms[i % maze.Rooms.size()];
+		pickups.push_back(CharacterBuilder::BuildPickup("Pickup", room, PlayerResourceId, maze.TheWorld));
+		enemies.push_back(CharacterBuilder::BuildEnemy("Enemy", room, EnemyResourceId, gamelib::Direction::Down,
+			maze.TheLevel, maze.TheWorld));
+	}
+
+	auto& gameData = maze.TheWorld.Data();
+	for (auto _ : state)
+	{
+		for (auto i = 0; i < count; i++)
+		{
+			gameData.AddPickup(pickups[i]);
+			gameData.AddEnemy(enemies[i]);
+		}
+		for (auto i = 0; i < count; i++)
+		{
+			gameData.RemovePickup(pickups[i]);
+			gameData.RemoveEnemy(enemies[i]);
+		}
+		benchmark::DoNotOptimize(gameData.CountPickups());
+	}
+	state.SetItemsProcessed(state.iterations() * count * 2);
+}
+BENCHMARK(BM_GameDataAddRemove)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+// Enemies spread over a size x size maze, each updating itself (0) or all moved by one enemy system pass (1)
+static void BM_EnemiesTick(benchmark::State& state)
+{
+	const auto size = static_cast<int>(state.range(0));
+	const auto count = static_cast<int>(state.range(1));
+	const auto batched = state.range(2) != 0;
+	Maze maze(size);
+	const auto enemies = maze.SpawnEnemies(count);
+
+	EnemySystem system(maze.TheWorld);
+	if (batched) { for (const auto& enemy : enemies) { system.Add(enemy); } }
+
+	for (auto _ : state)
+	{
+		if (batched) { system.Update(Simulation::DefaultTickMs); }
+		else { for (const auto& enemy : enemies) { enemy->Update(Simulation::DefaultTickMs); } }
+		maze.TheWorld.Events().ProcessAllEvents();
+	}
+
+	state.counters["enemies"] = count;
+	state.counters["ticks/s"] = benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+	state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_EnemiesTick)->Args({ 100, 1000, 0 })->Args({ 100, 1000, 1 })->Args({ 1000, 10000, 0 })
+	->Args({ 1000, 10000, 1 })->Unit(benchmark::kMillisecond);
+
+// Scaling of the batched enemy pass with the number of job system threads
+static void BM_EnemySystemThreads(benchmark::State& state)
+{
+	const auto count = static_cast<int>(state.range(0));
+	const auto threads = static_cast<unsigned int>(state.range(1));
+	Maze maze(1000);
+	const auto enemies = maze.SpawnEnemies(count);
+
+	EnemySystem system(maze.TheWorld);
+	for (const auto& enemy : enemies) { system.Add(enemy); }
+	JobSystem jobs(threads);
+
+	for (auto _ : state)
+	{
+		system.Update(Simulation::DefaultTickMs, &jobs);
+		maze.TheWorld.Events().ProcessAllEvents();
+	}
+
+	state.counters["threads"] = threads;
+	state.counters["ticks/s"] = benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+	state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_EnemySystemThreads)->Apply([](benchmark::internal::Benchmark* benchmark)
+	{
+		const auto cores = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+		for (auto threads = 1; threads < cores; threads *= 2) { benchmark->Args({ 50000, threads }); }
+		benchmark->Args({ 50000, cores });
+	})->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// Enemy moved events raised for count enemies and then delivered, each one allocated (0) or taken from the world's
+// pool (1)
+static void BM_RaiseEnemyMovedEvents(benchmark::State& state)
+{
+	const auto count = static_cast<int>(state.range(0));
+	const auto pooled = state.range(1) != 0;
+	Maze maze(10);
+	const auto enemies = maze.SpawnEnemies(count);
+	auto& events = maze.TheWorld.Events();
+	auto& pools = maze.TheWorld.Pools();
+
+	for (auto _ : state)
+	{
+		for (const auto& enemy : enemies)
+		{
+			events.RaiseEvent(pooled ? pools.MakeEnemyMovedEvent(enemy) : std::make_shared<EnemyMovedEvent>(enemy),
+				enemy.get());
+		}
+		events.ProcessAllEvents();
+	}
+
+	state.counters["events/s"] = benchmark::Counter(static_cast<double>(state.iterations() * count),
+		benchmark::Counter::kIsRate);
+	state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_RaiseEnemyMovedEvents)->Args({ 1000, 0 })->Args({ 1000, 1 })->Unit(benchmark::kMicrosecond);
+
+// Recovering the type of an event with a dynamic cast (0) or from its event number (1)
+static void BM_EnemyMovedEventCast(benchmark::State& state)
+{
+	const auto typed = state.range(0) != 0;
+	const std::shared_ptr<gamelib::Event> event = std::make_shared<EnemyMovedEvent>();
+
+	for (auto _ : state)
+	{
+		if (typed) { benchmark::DoNotOptimize(EventAs<EnemyMovedEvent>(event)); }
+		else { benchmark::DoNotOptimize(std::dynamic_pointer_cast<EnemyMovedEvent>(event)); }
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EnemyMovedEventCast)->Arg(0)->Arg(1);
+
+// One whole game tick of the test level, headless
+static void BM_SimulationTick(benchmark::State& state)
+{
+	gamelib::ResourceManager::Get()->Initialize("Resources.xml");
+	World world;
+	Simulation simulation(std::make_shared<Level>("Level1.xml", world));
+	simulation.Load();
+	simulation.SpawnPlayer(PlayerResourceId);
+	simulation.SetInput(Simulation::RandomInput(Seed));
+
+	for (auto _ : state)
+	{
+		simulation.Tick();
+	}
+	state.SetItemsProcessed(state.iterations());
+	gamelib::EventManager::Get()->Reset();
+}
+BENCHMARK(BM_SimulationTick)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,147 @@
+#include <benchmark/benchmark.h>
+#include <fstream>
+#include <string>
+#include <cppgamelib/events/EventManager.h>
+#include <cppgamelib/resource/ResourceManager.h>
+
+#include "AllocationCounter.h"
+#include "BinaryLevel.h"
+#include "EllerMazeGenerator.h"
+#include "Level.h"
+#include "LevelBaker.h"
+#include "LevelXmlRowSink.h"
+#include "MappedFile.h"
+#include "MazeGrid.h"
+#include "XmlStreamReader.h"
+
+using namespace mazer;
+using mazer::benchmarks::AllocationCounter;
+
+namespace
+{
+	// Writes a size x size XML level and its baked binary level, once per size
+	std::string MakeLevel(const int size)
+	{
+		const auto name = "BenchmarkLevel" + std::to_string(size);
+
+		if (!MappedFile(name + ".mzl").IsOpen())
+		{
+			{
+				std::ofstream xml(name + ".xml");
+				LevelXmlRowSink sink(xml, true, 1234);
+				EllerMazeGenerator(size, size, 1234).Generate(sink);
+			}
+			LevelBaker::Bake(name + ".xml", name + ".mzl");
+		}
+
+		return name;
+	}
+
+	// Counts elements without building anything, to measure the reader on its own
+	class CountingHandler final : public IXmlStreamHandler
+	{
+	public:
+		void OnStartElement(std::string_view, const XmlAttributes& attributes) override
+		{
+			Elements++;
+			benchmark::DoNotOptimize(attributes.GetCount());
+		}
+
+		std::size_t Elements = 0;
+	};
+
+	void LoadLevel(benchmark::State& state, const std::string& extension)
+	{
+		const auto size = static_cast<int>(state.range(0));
+		const auto fileName = MakeLevel(size) + extension;
+
+		for (auto _ : state)
+		{
+			const auto level = std::make_shared<Level>(fileName);
+			level->Load();
+			benchmark::DoNotOptimize(level->Grid.get());
+		}
+
+		state.counters["rooms"] = size * size;
+		state.SetItemsProcessed(state.iterations() * size * size);
+	}
+}
+
+// The level the tests use: 100 rooms and 12 pickups, with sprites
+static void BM_LoadTestLevel(benchmark::State& state)
+{
+	gamelib::ResourceManager::Get()->Initialize("Resources.xml");
+
+	for (auto _ : state)
+	{
+		const auto level = std::make_shared<Level>("Level1.xml");
+		level->Load();
+		benchmark::DoNotOptimize(level->Grid.get());
+
+		// Drop the events and subscriptions of the loaded objects
+		state.PauseTiming();
+		gamelib::EventManager::Get()->Reset();
+		state.ResumeTiming();
+	}
+
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LoadTestLevel)->Unit(benchmark::kMicrosecond);
+
+static void BM_LoadXmlLevel(benchmark::State& state)
+{
+	LoadLevel(state, ".xml");
+}
+BENCHMARK(BM_LoadXmlLevel)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+static void BM_LoadBinaryLevel(benchmark::State& state)
+{
+	LoadLevel(state, std::string(BinaryLevel::FileExtension));
+}
+BENCHMARK(BM_LoadBinaryLevel)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+// The cost of the format itself: mapping the file and copying the walls, without creating rooms
+static void BM_MapBinaryLevel(benchmark::State& state)
+{
+	const auto size = static_cast<int>(state.range(0));
+	const auto fileName = MakeLevel(size) + std::string(BinaryLevel::FileExtension);
+
+	for (auto _ : state)
+	{
+		const MappedFile file(fileName);
+		const BinaryLevel level(file.GetData(), file.GetSize());
+		MazeGrid grid(level.GetRows(), level.GetColumns(), false);
+		level.CopyWallsTo(grid);
+		benchmark::DoNotOptimize(grid.GetHorizontalWords().data());
+	}
+
+	state.counters["rooms"] = size * size;
+	state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(BM_MapBinaryLevel)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+// Throughput of the streaming reader in MB/s, and the memory it needs whatever the size of the level
+static void BM_ParseXmlLevel(benchmark::State& state)
+{
+	const auto size = static_cast<int>(state.range(0));
+	const auto fileName = MakeLevel(size) + ".xml";
+	std::uint64_t bytes = 0;
+	std::size_t allocated = 0;
+
+	for (auto _ : state)
+	{
+		CountingHandler handler;
+		XmlStreamReader reader;
+
+		AllocationCounter::Reset();
+		reader.ParseFile(fileName, handler);
+		allocated = AllocationCounter::GetBytes();
+		bytes = reader.GetBytesRead();
+		benchmark::DoNotOptimize(handler.Elements);
+	}
+
+	state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes));
+	state.counters["fileBytes"] = static_cast<double>(bytes);
+	state.counters["allocatedBytes"] = static_cast<double>(allocated);
+}
+BENCHMARK(BM_ParseXmlLevel)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+#include <thread>
+
+#include "EllerMazeGenerator.h"
+#include "KruskalMazeGenerator.h"
+#include "MazeGrid.h"
+#include "RoomGenerator.h"
+#include "TiledMazeGenerator.h"
+
+using namespace mazer;
+
+namespace
+{
+	constexpr auto Seed = 1234u;
+
+	void ReportRooms(benchmark::State& state, const int rooms)
+	{
+		state.counters["rooms"] = rooms;
+		state.SetItemsProcessed(state.iterations() * rooms);
+	}
+
+	// 1, 2, 4 ... up to the number of cores
+	void ThreadCounts(benchmark::internal::Benchmark* benchmark)
+	{
+		const auto cores = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+		for (auto threads = 1; threads < cores; threads *= 2)
+		{
+			benchmark->Args({ 2048, threads });
+		}
+		benchmark->Args({ 2048, cores });
+	}
+}
+
+static void BM_EllerGenerateGrid(benchmark::State& state)
+{
+	const auto size = static_cast<int>(state.range(0));
+	const EllerMazeGenerator generator(size, size, Seed);
+
+	for (auto _ : state)
+	{
+		auto grid = generator.GenerateGrid();
+		benchmark::DoNotOptimize(grid.get());
+	}
+
+	ReportRooms(state, size * size);
+}
+BENCHMARK(BM_EllerGenerateGrid)->Arg(2048)->Unit(benchmark::kMillisecond);
+
+static void BM_KruskalGenerateGrid(benchmark::State& state)
+{
+	const auto size = static_cast<int>(state.range(0));
+	const KruskalMazeGenerator generator(size, size, Seed, state.range(1) / 100.0);
+
+	for (auto _ : state)
+	{
+		auto grid = generator.GenerateGrid();
+		benchmark::DoNotOptimize(grid.get());
+	}
+
+	ReportRooms(state, size * size);
+}
+BENCHMARK(BM_KruskalGenerateGrid)->Args({ 1000, 0 })->Args({ 1000, 10 })->Unit(benchmark::kMillisecond);
+
+// Scaling of tiled generation with the number of worker threads
+static void BM_TiledGenerateGrid(benchmark::State& state)
+{
+	const auto size = static_cast<int>(state.range(0));
+	const auto threads = static_cast<unsigned int>(state.range(1));
+	const TiledMazeGenerator generator(size, size, Seed);
+
+	for (auto _ : state)
+	{
+		auto grid = generator.GenerateGrid(threads);
+		benchmark::DoNotOptimize(grid.get());
+	}
+
+	state.counters["threads"] = threads;
+	ReportRooms(state, size * size);
+}
+BENCHMARK(BM_TiledGenerateGrid)->Apply(ThreadCounts)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// The walls and a room for every cell, as an auto level is generated
+static void BM_RoomGeneratorGenerate(benchmark::State& state)
+{
+	const auto size = static_cast<int>(state.range(0));
+	const RoomGenerator generator(size * 32, size * 32, size, size, true, Seed);
+
+	for (auto _ : state)
+	{
+		auto rooms = generator.Generate();
+		benchmark::DoNotOptimize(rooms.data());
+	}
+
+	ReportRooms(state, size * size);
+}
+BENCHMARK(BM_RoomGeneratorGenerate)->Arg(10)->Arg(100)->Arg(500)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+
+#include "AllocationCounter.h"
+#include "MazeGrid.h"
+#include "Room.h"
+#include "RoomGenerator.h"
+
+using namespace mazer;
+using mazer::benchmarks::AllocationCounter;
+
+namespace
+{
+	constexpr auto ScreenWidth = 1024;
+	constexpr auto ScreenHeight = 768;
+
+	void ReportMemory(benchmark::State& state, const std::size_t bytes, const int rooms)
+	{
+		state.counters["bytesPerRoom"] = static_cast<double>(bytes) / rooms;
+		state.counters["rooms"] = rooms;
+		state.SetItemsProcessed(state.iterations() * rooms);
+	}
+}
+
+// One Room object per cell: what every level was made of before the grid
+static void BM_GenerateRooms(benchmark::State& state)
+{
+	const auto size = static_cast<int>(state.range(0));
+	const RoomGenerator generator(ScreenWidth, ScreenHeight, size, size, true);
+	std::size_t bytes = 0;
+
+	for (auto _ : state)
+	{
+		AllocationCounter::Reset();
+		auto rooms = generator.Generate();
+		bytes = AllocationCounter::GetBytes();
+		benchmark::DoNotOptimize(rooms.data());
+	}
+
+	ReportMemory(state, bytes, size * size);
+}
+BENCHMARK(BM_GenerateRooms)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+// Walls only, stored as shared edge bits
+static void BM_GenerateGrid(benchmark::State& state)
+{
+	const auto size = static_cast<int>(state.range(0));
+	const RoomGenerator generator(ScreenWidth, ScreenHeight, size, size, true);
+	std::size_t bytes = 0;
+
+	for (auto _ : state)
+	{
+		AllocationCounter::Reset();
+		auto grid = generator.GenerateGrid();
+		bytes = AllocationCounter::GetBytes();
+		benchmark::DoNotOptimize(grid.get());
+	}
+
+	ReportMemory(state, bytes, size * size);
+}
+BENCHMARK(BM_GenerateGrid)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+static void BM_GridNeighborWalk(benchmark::State& state)
+{
+	const auto size = static_cast<int>(state.range(0));
+	const MazeGrid grid(size, size);
+	auto index = 0;
+
+	for (auto _ : state)
+	{
+		for (auto side : { gamelib::Side::Top, gamelib::Side::Right, gamelib::Side::Bottom, gamelib::Side::Left })
+		{
+			const auto neighbor = grid.GetNeighborIndex(index, side);
+			benchmark::DoNotOptimize(grid.IsWalled(index, side));
+			benchmark::DoNotOptimize(neighbor);
+		}
+		index = (index + 1) % grid.GetRoomCount();
+	}
+	state.SetItemsProcessed(state.iterations() * 4);
+}
+BENCHMARK(BM_GridNeighborWalk)->Arg(1000);
@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "AllocationCounter.h"
+#include "KruskalMazeGenerator.h"
+#include "MazeGrid.h"
+#include "PathFinder.h"
+#include "RandomStream.h"
+
+using namespace mazer;
+using mazer::benchmarks::AllocationCounter;
+
+namespace
+{
+	constexpr auto Seed = 1234u;
+	constexpr auto Queries = 16;
+
+	// Random pairs of rooms, the same for every run
+	std::vector<std::pair<int, int>> MakeQueries(const int rooms)
+	{
+		RandomStream random(Seed);
+		std::vector<std::pair<int, int>> queries;
+		for (auto i = 0; i < Queries; i++)
+		{
+			queries.emplace_back(random.NextInt(rooms), random.NextInt(rooms));
+		}
+		return queries;
+	}
+
+	// Paths between random rooms of a size x size maze with braid percent of its walls re-opened
+	void FindPaths(benchmark::State& state, const PathFinder::Search search)
+	{
+		const auto size = static_cast<int>(state.range(0));
+		const KruskalMazeGenerator generator(size, size, Seed, state.range(1) / 100.0);
+		const auto grid = generator.GenerateGrid();
+		const auto queries = MakeQueries(grid->GetRoomCount());
+
+		PathFinder finder(grid, search);
+		std::vector<int> path;
+		path.reserve(grid->GetRoomCount());
+
+		// Warm up, so that the open list has grown to what the queries need
+		for (const auto& [from, to] : queries) { finder.FindPath(from, to, path); }
+
+		std::size_t allocations = 0;
+		std::int64_t expanded = 0;
+		for (auto _ : state)
+		{
+			AllocationCounter::Reset();
+			for (const auto& [from, to] : queries)
+			{
+				benchmark::DoNotOptimize(finder.FindPath(from, to, path));
+				expanded += finder.GetExpanded();
+			}
+			allocations += AllocationCounter::GetCount();
+		}
+
+		const auto count = static_cast<double>(state.iterations()) * Queries;
+		state.SetItemsProcessed(state.iterations() * Queries);
+		state.counters["queries/s"] = benchmark::Counter(count, benchmark::Counter::kIsRate);
+		state.counters["expanded/query"] = static_cast<double>(expanded) / count;
+		state.counters["allocs/query"] = static_cast<double>(allocations) / count;
+	}
+}
+
+static void BM_PathFinderAStar(benchmark::State& state)
+{
+	FindPaths(state, PathFinder::Search::AStar);
+}
+BENCHMARK(BM_PathFinderAStar)->Args({ 100, 0 })->Args({ 100, 10 })->Args({ 1000, 0 })->Args({ 1000, 10 })
+	->Unit(benchmark::kMicrosecond);
+
+static void BM_PathFinderJumpPoint(benchmark::State& state)
+{
+	FindPaths(state, PathFinder::Search::JumpPoint);
+}
+BENCHMARK(BM_PathFinderJumpPoint)->Args({ 100, 0 })->Args({ 100, 10 })->Args({ 1000, 0 })->Args({ 1000, 10 })
+	->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "RoomLocator.h"
+
+using namespace mazer;
+
+namespace
+{
+	constexpr auto SquareSize = 32;
+
+	struct Rect
+	{
+		int X, Y, W, H;
+
+		[[nodiscard]] bool Contains(const int x, const int y) const { return x >= X && x < X + W && y >= Y && y < Y + H; }
+	};
+
+	std::vector<Rect> MakeRooms(const int size)
+	{
+		std::vector<Rect> rooms;
+		rooms.reserve(static_cast<std::size_t>(size) * size);
+		for (auto row = 0; row < size; row++)
+		{
+			for (auto column = 0; column < size; column++)
+			{
+				rooms.push_back({ column * SquareSize, row * SquareSize, SquareSize, SquareSize });
+			}
+		}
+		return rooms;
+	}
+}
+
+// Every room is asked whether the mover is inside it, which is what each move cost when rooms handled move events
+static void BM_LocateRoomByAskingEveryRoom(benchmark::State& state)
+{
+	const auto size = static_cast<int>(state.range(0));
+	const auto rooms = MakeRooms(size);
+	const auto extent = size * SquareSize;
+	auto step = 0;
+
+	for (auto _ : state)
+	{
+		const auto x = (step * 7) % extent;
+		const auto y = (step * 13) % extent;
+		auto found = -1;
+		for (auto i = 0; i < static_cast<int>(rooms.size()); i++)
+		{
+			if (rooms[i].Contains(x, y)) { found = i; }
+		}
+		benchmark::DoNotOptimize(found);
+		step++;
+	}
+
+	state.counters["rooms"] = static_cast<double>(rooms.size());
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LocateRoomByAskingEveryRoom)->Arg(10)->Arg(100)->Arg(1000);
+
+static void BM_LocateRoomByPosition(benchmark::State& state)
+{
+	const auto size = static_cast<int>(state.range(0));
+	const RoomLocator locator(size, size, SquareSize, SquareSize);
+	const auto extent = size * SquareSize;
+	auto step = 0;
+
+	for (auto _ : state)
+	{
+		const auto x = (step * 7) % extent;
+		const auto y = (step * 13) % extent;
+		benchmark::DoNotOptimize(locator.GetRoomIndex(x, y));
+		step++;
+	}
+
+	state.counters["rooms"] = static_cast<double>(size) * size;
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LocateRoomByPosition)->Arg(10)->Arg(100)->Arg(1000);
@@ -10,6 +10,7 @@
 #include "GameData.h"
 #include "GameObjectEventFactory.h"
 #include "PlayerCollidedWithPickupEvent.h"
+#include "PooledEvents.h"
 #include "SDLCollisionDetection.h"
 #include "character/AnimatedSprite.h"
 #include "Player.h"
@@ -20,8 +21,8 @@ using namespace std;
 namespace mazer
 {
 	Pickup::Pickup(const std::string& name, const std::string& type, const int x, const int y, const int width,
-		const int height, const bool visible, const int inRoomNumber)
-		: DrawableGameObject(name, type, gamelib::Coordinate(x, y), visible)
+		const int height, const bool visible, const int inRoomNumber, World& world)
+		: DrawableGameObject(name, type, gamelib::Coordinate(x, y), visible), world(&world)
 	{
 		this->IsVisible = visible;
 		this->width = width;
@@ -31,8 +32,8 @@ namespace mazer
 
 	Pickup::Pickup(const std::string& name, const std::string& type, const gamelib::Coordinate<int> startingPoint,
 		// ReSharper disable once CppPassValueParameterByConstReference
-		const bool visible, const int inRoomNumber, const std::shared_ptr<gamelib::SpriteAsset> asset)  // NOLINT(performance-unnecessary-value-param)
-		: DrawableGameObject(name, type, gamelib::Coordinate(startingPoint.GetX(), startingPoint.GetY()), visible)
+		const bool visible, const int inRoomNumber, const std::shared_ptr<gamelib::SpriteAsset> asset, World& world)  // NOLINT(performance-unnecessary-value-param)
+		: DrawableGameObject(name, type, gamelib::Coordinate(startingPoint.GetX(), startingPoint.GetY()), visible), world(&world)
 	{
 		this->IsVisible = visible;
 		this->Asset = asset;
@@ -41,7 +42,7 @@ namespace mazer
 		this->RoomNumber = inRoomNumber;
 	}
 
-	Pickup::Pickup(const bool visible) : DrawableGameObject(0, 0, visible)
+	Pickup::Pickup(const bool visible, World& world) : DrawableGameObject(0, 0, visible), world(&world)
 	{
 		this->IsVisible = visible;
 		this->width = 0;
@@ -65,25 +66,28 @@ namespace mazer
 		// Player moved?
 		if (event->Id.PrimaryId == gamelib::PlayerMovedEventTypeEventId.PrimaryId)
 		{
-			const auto player = GameData::Get()->GetPlayer();
+			const auto player = world->Data().GetPlayer();
 
 			// Check if the player collided with us...
-			if (IsInSameRoomAsPlayer(player))
+			if (IsInSameRoomAsPlayer(player) && SdlCollisionDetection::IsColliding(&player->Bounds, &Bounds))
 			{
-				if (SdlCollisionDetection::IsColliding(&player->Bounds, &Bounds))
-				{
-					// Yes
-					generatedEvents.push_back(gamelib::EventFactory::Get()->CreateGenericEvent(FetchedPickupEventId, GetSubscriberName()));
-					generatedEvents.push_back(make_shared<PlayerCollidedWithPickupEvent>(player, shared_from_this()));
-
-					// Schedule ourselves to be removed from the game
-					generatedEvents.push_back(GameObjectEventFactory::MakeRemoveObjectEvent(shared_from_this()));
-				}
+				generatedEvents = CollideWithPlayer(player);
 			}
 		}
 		return generatedEvents;
 	}
 
+	gamelib::ListOfEvents Pickup::CollideWithPlayer(const std::shared_ptr<Player>& player)
+	{
+		gamelib::ListOfEvents generatedEvents;
+		generatedEvents.push_back(gamelib::EventFactory::Get()->CreateGenericEvent(FetchedPickupEventId, GetSubscriberName()));
+		generatedEvents.push_back(world->Pools().MakePlayerCollidedWithPickupEvent(player, shared_from_this()));
+
+		// Schedule ourselves to be removed from the game
+		generatedEvents.push_back(GameObjectEventFactory::MakeRemoveObjectEvent(shared_from_this()));
+		return generatedEvents;
+	}
+
 	void Pickup::Draw(SDL_Renderer* renderer)
 	{
 		sprite->Draw(renderer);
@@ -3,6 +3,9 @@
 #include <geometry/Coordinate.h>
 #include <objects/DrawableGameObject.h>
 
+#include "SlotMap.h"
+#include "World.h"
+
 namespace gamelib
 {
 	class AnimatedSprite;
@@ -19,31 +22,37 @@ namespace mazer
 	{
 	public:
 		Pickup(const std::string& name, const std::string& type, const int x, const int y, const int width,
-			const int height, const bool visible, const int inRoomNumber);
+			const int height, const bool visible, const int inRoomNumber, World& world = World::Default());
 
 		Pickup(const std::string& name, const std::string& type, const gamelib::Coordinate<int> startingPoint, const bool visible,
-			const int inRoomNumber, const std::shared_ptr<gamelib::SpriteAsset> asset);
+			const int inRoomNumber, const std::shared_ptr<gamelib::SpriteAsset> asset, World& world = World::Default());
 
-		explicit Pickup(const bool visible);
+		explicit Pickup(const bool visible, World& world = World::Default());
 
 		gamelib::GameObjectType GetGameObjectType() override;
 
 		std::string GetSubscriberName() override;
 		std::string GetName() override;
 		bool IsInSameRoomAsPlayer(std::shared_ptr<Player> player) const;
+		[[nodiscard]] World& GetWorld() const { return *world; }
 		gamelib::ListOfEvents HandleEvent(const std::shared_ptr<gamelib::Event>& event, const unsigned long deltaMs) override;
 
+		// The events of being picked up, for a player known to be touching the pickup
+		gamelib::ListOfEvents CollideWithPlayer(const std::shared_ptr<Player>& player);
+
 		void Initialize();
 		void Draw(SDL_Renderer* renderer) override;
 		void Update(unsigned long deltaMs) override;
 
 		int RoomNumber;
 		std::shared_ptr<gamelib::Asset> Asset;
+		SlotHandle Handle; // in the game data, while registered
 
 	protected:
 		void SetBounds();
 
 	private:
+		World* world;
 		int width;
 		int height;
 		std::shared_ptr<gamelib::AnimatedSprite> sprite;
@@ -0,0 +1,113 @@
+#include "pch.h"
+#include <cstdint>
+#include <vector>
+
+#include "BatchCollisionDetection.h"
+#include "RandomStream.h"
+
+using namespace mazer;
+
+namespace
+{
+	constexpr BatchCollisionDetection::Kernel Kernels[] = { BatchCollisionDetection::Kernel::Scalar,
+		BatchCollisionDetection::Kernel::Sse2, BatchCollisionDetection::Kernel::Avx2 };
+
+	struct Batch
+	{
+		std::vector<int> Xs;
+		std::vector<int> Ys;
+		std::vector<int> Widths;
+		std::vector<int> Heights;
+
+		void Add(const SDL_Rect& rect)
+		{
+			Xs.push_back(rect.x);
+			Ys.push_back(rect.y);
+			Widths.push_back(rect.w);
+			Heights.push_back(rect.h);
+		}
+
+		[[nodiscard]] SDL_Rect Get(const std::size_t index) const
+		{
+			return { Xs[index], Ys[index], Widths[index], Heights[index] };
+		}
+
+		[[nodiscard]] BoundsColumns Columns() const { return { Xs.data(), Ys.data(), Widths.data(), Heights.data() }; }
+	};
+
+	// Small rectangles, some empty, close enough together that about half of them overlap
+	SDL_Rect RandomRect(RandomStream& random)
+	{
+		return { random.NextInt(40), random.NextInt(40), random.NextInt(24) - 2, random.NextInt(24) - 2 };
+	}
+}
+
+TEST(BatchCollisionDetectionTests, Scalar_Is_Always_Supported)
+{
+	EXPECT_TRUE(BatchCollisionDetection::IsSupported(BatchCollisionDetection::Kernel::Scalar));
+	EXPECT_TRUE(BatchCollisionDetection::IsSupported(BatchCollisionDetection::GetBestKernel()));
+}
+
+TEST(BatchCollisionDetectionTests, Edges_Touching_Do_Not_Overlap)
+{
+	Batch batch;
+	batch.Add({ 10, 0, 10, 10 }); // touches the right edge
+	batch.Add({ 9, 0, 10, 10 });  // overlaps by one column
+	batch.Add({ 0, 10, 10, 10 }); // touches the bottom edge
+	batch.Add({ 0, 9, 10, 10 });  // overlaps by one row
+	batch.Add({ 2, 2, 0, 5 });    // empty
+	batch.Add({ 2, 2, 5, -1 });   // empty
+	batch.Add({ -5, -5, 30, 30 }); // contains it
+
+	constexpr SDL_Rect bounds = { 0, 0, 10, 10 };
+	for (const auto kernel : Kernels)
+	{
+		EXPECT_EQ(BatchCollisionDetection::Overlaps(bounds, batch.Columns(), 0, batch.Xs.size(), kernel), 0b1001010u);
+	}
+
+	constexpr SDL_Rect empty = { 0, 0, 0, 10 };
+	EXPECT_EQ(BatchCollisionDetection::Overlaps(empty, batch.Columns(), 0, batch.Xs.size()), 0u);
+}
+
+TEST(BatchCollisionDetectionTests, Kernels_Agree_With_SDL)
+{
+	RandomStream random(17);
+	Batch batch;
+	for (auto i = 0; i < 1000; i++) { batch.Add(RandomRect(random)); }
+
+	// Batches of every length from every offset, so that each kernel also finishes off partial steps
+	for (auto test = 0; test < 200; test++)
+	{
+		const auto bounds = RandomRect(random);
+		const auto first = static_cast<std::size_t>(random.NextInt(900));
+		const auto count = static_cast<std::size_t>(test % (BatchCollisionDetection::MaxBatch + 1));
+
+		std::uint64_t expected = 0;
+		for (std::size_t i = 0; i < count; i++)
+		{
+			const auto rect = batch.Get(first + i);
+			if (SDL_HasIntersection(&bounds, &rect)) { expected |= std::uint64_t{ 1 } << i; }
+		}
+
+		for (const auto kernel : Kernels)
+		{
+			EXPECT_EQ(BatchCollisionDetection::Overlaps(bounds, batch.Columns(), first, count, kernel), expected);
+		}
+		EXPECT_EQ(BatchCollisionDetection::Overlaps(bounds, batch.Columns(), first, count), expected);
+	}
+}
+
+TEST(BatchCollisionDetectionTests, Bounds_Batch_Can_Be_Refilled)
+{
+	BoundsBatch batch;
+	batch.Add({ 20, 0, 10, 10 });
+	batch.Add({ 5, 5, 10, 10 });
+	constexpr SDL_Rect bounds = { 0, 0, 10, 10 };
+	EXPECT_EQ(BatchCollisionDetection::Overlaps(bounds, batch.GetColumns(), 0, batch.size()), 0b10u);
+
+	batch.Clear();
+	EXPECT_EQ(batch.size(), 0u);
+	batch.Add({ 5, 5, 10, 10 });
+	EXPECT_EQ(batch.size(), 1u);
+	EXPECT_EQ(BatchCollisionDetection::Overlaps(bounds, batch.GetColumns(), 0, batch.size()), 0b1u);
+}
@@ -0,0 +1,129 @@
+#include "pch.h"
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+#include "BinaryLevel.h"
+#include "KruskalMazeGenerator.h"
+#include "MappedFile.h"
+#include "MazeGrid.h"
+#include "MazeTestHelpers.h"
+
+using namespace mazer;
+
+namespace
+{
+	std::string WriteLevel(const BinaryLevelWriter& writer)
+	{
+		std::stringstream output;
+		writer.Write(output);
+		return output.str();
+	}
+
+	BinaryLevel ReadLevel(const std::string& bytes)
+	{
+		return { reinterpret_cast<const std::uint8_t*>(bytes.data()), bytes.size() };
+	}
+}
+
+TEST(BinaryLevelTests, RoundTrip)
+{
+	const auto grid = KruskalMazeGenerator(20, 70, 11).GenerateGrid();
+	BinaryLevelWriter writer(*grid, 11, false);
+	writer.AddObject(5, "GoldPickup", "Pickup", 19);
+	writer.SetProperty("value", "5");
+	writer.AddObject(1, "Player1", "Player", 1);
+
+	const auto bytes = WriteLevel(writer);
+	const auto level = ReadLevel(bytes);
+
+	ASSERT_TRUE(level.IsValid());
+	EXPECT_EQ(level.GetRows(), 20);
+	EXPECT_EQ(level.GetColumns(), 70);
+	EXPECT_EQ(level.GetSeed(), 11u);
+	EXPECT_FALSE(level.IsAutoPopulatePickups());
+
+	MazeGrid loaded(20, 70, false);
+	level.CopyWallsTo(loaded);
+	EXPECT_TRUE(tests::HaveSameWalls(*grid, loaded));
+
+	// Objects are sorted by room
+	ASSERT_EQ(level.GetObjectCount(), 2);
+	EXPECT_EQ(level.GetObject(0).Name, "Player1");
+	EXPECT_EQ(level.GetObject(0).PropertyCount, 0);
+
+	const auto pickup = level.GetObject(1);
+	EXPECT_EQ(pickup.Room, 5);
+	EXPECT_EQ(pickup.Type, "Pickup");
+	EXPECT_EQ(pickup.ResourceId, 19);
+	ASSERT_EQ(pickup.PropertyCount, 1);
+	EXPECT_EQ(level.GetProperty(pickup, 0).first, "value");
+	EXPECT_EQ(level.GetProperty(pickup, 0).second, "5");
+}
+
+TEST(BinaryLevelTests, StringsAreInterned)
+{
+	const MazeGrid grid(10, 10);
+	BinaryLevelWriter one(grid, 0, true);
+	BinaryLevelWriter many(grid, 0, true);
+
+	one.AddObject(0, "SilverPickup", "Pickup", 20);
+	for (auto room = 0; room < 100; room++)
+	{
+		many.AddObject(room, "SilverPickup", "Pickup", 20);
+
+		// Repeated keys keep the last value, as they do when loading XML
+		many.SetProperty("name", "name");
+		many.SetProperty("value", "name");
+		many.SetProperty("value", "10");
+	}
+
+	const auto bytes = WriteLevel(many);
+	const auto level = ReadLevel(bytes);
+
+	ASSERT_TRUE(level.IsValid());
+	EXPECT_EQ(level.GetObject(42).PropertyCount, 2);
+	EXPECT_EQ(level.GetProperty(level.GetObject(42), 1).second, "10");
+
+	// Each object costs a fixed size record, the text is only stored once
+	const auto perObject = (bytes.size() - WriteLevel(one).size()) / 99;
+	EXPECT_LE(perObject, sizeof(BinaryLevelObject) + 2 * sizeof(BinaryLevelProperty) + 8);
+}
+
+TEST(BinaryLevelTests, RejectsInvalidData)
+{
+	const MazeGrid grid(4, 4);
+	auto bytes = WriteLevel(BinaryLevelWriter(grid, 0, true));
+
+	EXPECT_TRUE(ReadLevel(bytes).IsValid());
+	EXPECT_FALSE(ReadLevel(bytes.substr(0, bytes.size() - 8)).IsValid());
+	EXPECT_FALSE(ReadLevel("<?xml version=\"1.0\"?>").IsValid());
+
+	bytes[0] = 'X';
+	EXPECT_FALSE(ReadLevel(bytes).IsValid());
+}
+
+TEST(BinaryLevelTests, LoadsFromMappedFile)
+{
+	const auto fileName = std::string("BinaryLevelTests.mzl");
+	const auto grid = KruskalMazeGenerator(100, 100, 3).GenerateGrid();
+	BinaryLevelWriter writer(*grid, 3, true);
+	writer.AddObject(99, "Enemy1", "Enemy", 18);
+	ASSERT_TRUE(writer.Save(fileName));
+
+	{
+		const MappedFile file(fileName);
+		ASSERT_TRUE(file.IsOpen());
+
+		const BinaryLevel level(file.GetData(), file.GetSize());
+		ASSERT_TRUE(level.IsValid());
+		EXPECT_EQ(level.GetObject(0).Name, "Enemy1");
+
+		MazeGrid loaded(100, 100, false);
+		level.CopyWallsTo(loaded);
+		EXPECT_TRUE(tests::IsPerfectMaze(loaded));
+	}
+
+	std::remove(fileName.c_str());
+	EXPECT_FALSE(MappedFile(fileName).IsOpen());
+}
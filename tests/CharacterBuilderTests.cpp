@@ -72,8 +72,8 @@ TEST_F(CharacterBuilderTests, BuildEnemyWorks)
 	// When initializing the enemy object...
 	enemy->Initialize();
 
-	// Ensure the initialization is correct
-	EXPECT_TRUE(enemy->SubscribesTo(gamelib::PlayerMovedEventTypeEventId));
+	// Ensure the initialization is correct: the player finds the enemies it touches, so they need no move events
+	EXPECT_FALSE(enemy->SubscribesTo(gamelib::PlayerMovedEventTypeEventId));
 
 }
 
@@ -91,7 +91,7 @@ TEST_F(CharacterBuilderTests, BuildPickupWorks)
 	EXPECT_TRUE(pickup->IsActive);
 	EXPECT_TRUE(pickup->Position == room->GetCenter(expectedAssetDimensions));
 	EXPECT_TRUE(pickup->Asset->Uid == myResourceId);
-	EXPECT_TRUE(pickup->SubscribesTo(gamelib::PlayerMovedEventTypeEventId));
+	EXPECT_FALSE(pickup->SubscribesTo(gamelib::PlayerMovedEventTypeEventId));
 }
 
 TEST_F(CharacterBuilderTests, BuildPlayerWorks)
@@ -0,0 +1,98 @@
+#include "pch.h"
+#include "CorridorSegments.h"
+#include "KruskalMazeGenerator.h"
+#include "MazeGrid.h"
+#include "RandomStream.h"
+
+using namespace mazer;
+using namespace gamelib;
+
+TEST(CorridorSegmentsTests, Sees_Along_Open_Rows_And_Columns)
+{
+	//  0 1 2
+	//  3 4 5    open: 0-1-2 along the top, 1-4 down the middle
+	const auto grid = std::make_shared<MazeGrid>(2, 3);
+	grid->RemoveWall(0, Side::Right);
+	grid->RemoveWall(1, Side::Right);
+	grid->RemoveWall(1, Side::Bottom);
+
+	CorridorSegments segments;
+	segments.Build(grid);
+
+	EXPECT_EQ(segments.GetRowSegment(2), 0);
+	EXPECT_EQ(segments.GetColumnSegment(4), 1);
+	EXPECT_EQ(segments.GetRowSegment(9), -1);
+
+	EXPECT_TRUE(segments.CanSee(0, 2));
+	EXPECT_TRUE(segments.CanSee(4, 1));
+	EXPECT_FALSE(segments.CanSee(3, 4));
+	EXPECT_FALSE(segments.CanSee(0, 4));
+	EXPECT_FALSE(segments.CanSee(1, 1));
+
+	EXPECT_TRUE(segments.CanSee(0, 2, Direction::Right));
+	EXPECT_FALSE(segments.CanSee(0, 2, Direction::Left));
+	EXPECT_TRUE(segments.CanSee(2, 0, Direction::Left));
+	EXPECT_TRUE(segments.CanSee(4, 1, Direction::Up));
+	EXPECT_FALSE(segments.CanSee(4, 1, Direction::Down));
+}
+
+TEST(CorridorSegmentsTests, Wall_Changes_Patch_The_Segment)
+{
+	const auto grid = std::make_shared<MazeGrid>(1, 4);
+	for (auto i = 0; i < 3; i++) { grid->RemoveWall(i, Side::Right); }
+
+	CorridorSegments segments;
+	segments.Build(grid);
+	EXPECT_TRUE(segments.CanSee(0, 3));
+
+	grid->AddWall(2, Side::Left);
+	segments.OnWallChanged(*grid, 2, Side::Left);
+	EXPECT_TRUE(segments.CanSee(0, 1));
+	EXPECT_FALSE(segments.CanSee(0, 3));
+	EXPECT_TRUE(segments.CanSee(2, 3));
+	EXPECT_EQ(segments.GetRowSegment(3), 2);
+
+	grid->RemoveWall(1, Side::Right);
+	segments.OnWallChanged(*grid, 1, Side::Right);
+	EXPECT_TRUE(segments.CanSee(0, 3));
+	EXPECT_EQ(segments.GetRowSegment(3), 0);
+}
+
+TEST(CorridorSegmentsTests, Patches_Match_A_Rebuild)
+{
+	const KruskalMazeGenerator generator(16, 16, 5, 0.1);
+	const auto grid = generator.GenerateGrid();
+	CorridorSegments patched;
+	patched.Build(grid);
+
+	RandomStream random(17);
+	constexpr Side sides[] = { Side::Top, Side::Right, Side::Bottom, Side::Left };
+	for (auto change = 0; change < 500; change++)
+	{
+		const auto index = random.NextInt(grid->GetRoomCount());
+		const auto side = sides[random.NextInt(4)];
+		grid->SetWall(index, side, random.NextBool());
+		patched.OnWallChanged(*grid, index, side);
+	}
+
+	CorridorSegments rebuilt;
+	rebuilt.Build(grid);
+	for (auto i = 0; i < grid->GetRoomCount(); i++)
+	{
+		EXPECT_EQ(patched.GetRowSegment(i), rebuilt.GetRowSegment(i)) << "room " << i;
+		EXPECT_EQ(patched.GetColumnSegment(i), rebuilt.GetColumnSegment(i)) << "room " << i;
+	}
+}
+
+TEST(CorridorSegmentsTests, Ignores_Changes_To_Other_Grids)
+{
+	const auto grid = std::make_shared<MazeGrid>(1, 2);
+	const auto other = std::make_shared<MazeGrid>(1, 2);
+	grid->RemoveWall(0, Side::Right);
+
+	CorridorSegments segments;
+	segments.Build(grid);
+	segments.OnWallChanged(*other, 0, Side::Right);
+
+	EXPECT_TRUE(segments.CanSee(0, 1));
+}
@@ -0,0 +1,52 @@
+#include "pch.h"
+#include "DisjointSet.h"
+
+using namespace mazer;
+
+TEST(DisjointSetTests, EachElementStartsInItsOwnSet)
+{
+	DisjointSet sets(5);
+
+	EXPECT_EQ(sets.GetSize(), 5);
+	EXPECT_EQ(sets.GetSetCount(), 5);
+	for (auto i = 0; i < 5; i++) { EXPECT_EQ(sets.Find(i), i); }
+}
+
+TEST(DisjointSetTests, Union)
+{
+	DisjointSet sets(6);
+
+	EXPECT_TRUE(sets.Union(0, 1));
+	EXPECT_TRUE(sets.Union(2, 3));
+	EXPECT_TRUE(sets.Union(1, 3));
+
+	// Already joined
+	EXPECT_FALSE(sets.Union(0, 2));
+
+	EXPECT_TRUE(sets.IsSameSet(0, 3));
+	EXPECT_FALSE(sets.IsSameSet(0, 4));
+	EXPECT_EQ(sets.GetSetCount(), 3);
+}
+
+TEST(DisjointSetTests, Reset)
+{
+	DisjointSet sets(3);
+	sets.Union(0, 2);
+
+	sets.Reset(4);
+
+	EXPECT_EQ(sets.GetSize(), 4);
+	EXPECT_EQ(sets.GetSetCount(), 4);
+	EXPECT_FALSE(sets.IsSameSet(0, 2));
+}
+
+TEST(DisjointSetTests, LongChains)
+{
+	constexpr auto size = 100000;
+	DisjointSet sets(size);
+
+	for (auto i = 1; i < size; i++) { sets.Union(i - 1, i); }
+
+	EXPECT_EQ(sets.GetSetCount(), 1);
+	EXPECT_TRUE(sets.IsSameSet(0, size - 1));
+}
@@ -0,0 +1,102 @@
+#include "pch.h"
+#include <sstream>
+
+#include "EllerMazeGenerator.h"
+#include "LevelXmlRowSink.h"
+#include "MazeGrid.h"
+#include "MazeRow.h"
+#include "MazeTestHelpers.h"
+
+using namespace mazer;
+
+namespace
+{
+	// Counts rows and remembers the widest row seen, without storing the maze
+	class CountingRowSink final : public IMazeRowSink
+	{
+	public:
+		void OnBegin(const int, const int inColumns) override { begun = true; columns = inColumns; }
+		void OnRow(const MazeRow& row) override { EXPECT_EQ(row.Row, rows); EXPECT_EQ(row.GetColumns(), columns); rows++; }
+		void OnEnd() override { ended = true; }
+
+		bool begun = false;
+		bool ended = false;
+		int rows = 0;
+		int columns = 0;
+	};
+}
+
+TEST(EllerMazeGeneratorTests, GeneratesPerfectMaze)
+{
+	const EllerMazeGenerator generator(30, 40, 1234);
+	const auto grid = generator.GenerateGrid();
+
+	EXPECT_EQ(grid->GetRows(), 30);
+	EXPECT_EQ(grid->GetColumns(), 40);
+	EXPECT_TRUE(tests::HasOuterWalls(*grid));
+	EXPECT_TRUE(tests::IsPerfectMaze(*grid));
+}
+
+TEST(EllerMazeGeneratorTests, GeneratesPerfectMazeOfAnyShape)
+{
+	for (const auto& [rows, columns] : std::vector<std::pair<int, int>>{ {1, 1}, {1, 50}, {50, 1}, {2, 2}, {7, 130} })
+	{
+		const auto grid = EllerMazeGenerator(rows, columns, 99).GenerateGrid();
+		EXPECT_TRUE(tests::IsPerfectMaze(*grid)) << rows << "x" << columns;
+	}
+}
+
+TEST(EllerMazeGeneratorTests, SameSeedSameMaze)
+{
+	const auto first = EllerMazeGenerator(20, 20, 42).GenerateGrid();
+	const auto second = EllerMazeGenerator(20, 20, 42).GenerateGrid();
+	const auto other = EllerMazeGenerator(20, 20, 43).GenerateGrid();
+
+	EXPECT_TRUE(tests::HaveSameWalls(*first, *second));
+	EXPECT_FALSE(tests::HaveSameWalls(*first, *other));
+}
+
+TEST(EllerMazeGeneratorTests, StreamsRows)
+{
+	CountingRowSink sink;
+	EllerMazeGenerator(100, 17, 7).Generate(sink);
+
+	EXPECT_TRUE(sink.begun);
+	EXPECT_TRUE(sink.ended);
+	EXPECT_EQ(sink.rows, 100);
+	EXPECT_EQ(sink.columns, 17);
+}
+
+TEST(EllerMazeGeneratorTests, WritesLevelXml)
+{
+	std::stringstream xml;
+	LevelXmlRowSink sink(xml);
+	EllerMazeGenerator(3, 4, 5).Generate(sink);
+
+	const auto text = xml.str();
+	EXPECT_NE(text.find("<level cols=\"4\" rows=\"3\""), std::string::npos);
+	EXPECT_NE(text.find("<room number=\"0\" top=\"True\""), std::string::npos);
+	EXPECT_NE(text.find("<room number=\"11\""), std::string::npos);
+	EXPECT_EQ(text.find("<room number=\"12\""), std::string::npos);
+	EXPECT_NE(text.find("</level>"), std::string::npos);
+}
+
+TEST(EllerMazeGeneratorTests, WritesLevelSeed)
+{
+	std::stringstream xml;
+	LevelXmlRowSink sink(xml, true, 987654321);
+	EllerMazeGenerator(2, 2, 987654321).Generate(sink);
+
+	EXPECT_NE(xml.str().find("seed=\"987654321\""), std::string::npos);
+}
+
+TEST(EllerMazeGeneratorTests, MazeWithoutRoomsSendsNothing)
+{
+	for (const auto& [rows, columns] : std::vector<std::pair<int, int>>{ {0, 5}, {5, 0}, {-1, 5}, {5, -1} })
+	{
+		CountingRowSink sink;
+		EllerMazeGenerator(rows, columns, 1).Generate(sink);
+		EXPECT_FALSE(sink.begun) << rows << "x" << columns;
+		EXPECT_EQ(sink.rows, 0);
+	}
+}
@@ -0,0 +1,110 @@
+#include <cppgamelib/events/EventManager.h>
+#include <gtest/gtest.h>
+
+#include "CharacterBuilder.h"
+#include "Enemy.h"
+#include "EnemySystem.h"
+#include "GameData.h"
+#include "Level.h"
+#include "MazeGrid.h"
+#include "Room.h"
+#include "RoomGenerator.h"
+#include "World.h"
+#include "cppgamelib/resource/ResourceManager.h"
+
+using namespace mazer;
+
+class EnemySystemTests : public testing::Test
+{
+public:
+	void SetUp() override
+	{
+		gamelib::ResourceManager::Get()->Initialize("Resources.xml");
+
+		// Three rooms in a row, open to each other
+		const auto grid = std::make_shared<MazeGrid>(1, 3);
+		grid->RemoveWall(0, gamelib::Side::Right);
+		grid->RemoveWall(1, gamelib::Side::Right);
+
+		const RoomGenerator generator(600, 200, 1, 3, false, 1);
+		rooms = generator.CreateRooms(grid, world);
+		for (const auto& room : rooms) { world.Data().AddRoom(room); }
+		level = std::make_shared<Level>(world);
+	}
+
+	void TearDown() override
+	{
+		gamelib::EventManager::Get()->Reset();
+	}
+
+	std::shared_ptr<Enemy> AddEnemy(const int roomNumber, const gamelib::Direction direction)
+	{
+		auto enemy = CharacterBuilder::BuildEnemy("Enemy", rooms[roomNumber], enemyResourceId, direction, level, world);
+		enemy->Initialize();
+		world.Data().AddEnemy(enemy);
+		return enemy;
+	}
+
+	World world;
+	std::vector<std::shared_ptr<Room>> rooms;
+	std::shared_ptr<Level> level;
+	int enemyResourceId = 18;
+	int playerResourceId = 188;
+};
+
+TEST_F(EnemySystemTests, Moves_Enemies_Within_Their_Walls)
+{
+	const auto enemy = AddEnemy(2, gamelib::Direction::Down);
+	EnemySystem system(world);
+	system.Add(enemy);
+
+	EXPECT_EQ(system.size(), 1u);
+	EXPECT_EQ(enemy->GetEnemySystem(), &system);
+	EXPECT_EQ(system.GetRoom(0), 2);
+
+	const auto startY = system.GetY(0);
+	system.Update(16);
+	EXPECT_GT(system.GetY(0), startY);
+
+	for (auto tick = 0; tick < 500; tick++) { system.Update(16); }
+
+	// Down and back up between the top and bottom walls, never out of the room
+	EXPECT_EQ(system.GetRoom(0), 2);
+	EXPECT_GE(system.GetY(0), 0);
+	EXPECT_LE(system.GetY(0), 200);
+
+	system.Sync();
+	EXPECT_EQ(enemy->Position.GetY(), system.GetY(0));
+	EXPECT_EQ(enemy->Position.GetX(), system.GetX(0));
+}
+
+TEST_F(EnemySystemTests, Chases_A_Player_In_Sight)
+{
+	CharacterBuilder::BuildPlayer("Player", rooms[0], playerResourceId, "Test", world);
+	const auto enemy = AddEnemy(2, gamelib::Direction::Down);
+	EnemySystem system(world);
+	system.Add(enemy);
+
+	system.Update(16);
+
+	EXPECT_EQ(system.GetDirection(0), gamelib::Direction::Left);
+}
+
+TEST_F(EnemySystemTests, Drops_Enemies_Removed_From_The_Game_Data)
+{
+	const auto enemy = AddEnemy(1, gamelib::Direction::Up);
+	const auto other = AddEnemy(2, gamelib::Direction::Up);
+	EnemySystem system(world);
+	system.Add(enemy);
+	system.Add(other);
+
+	world.Data().RemoveEnemy(enemy);
+	system.Update(16);
+
+	EXPECT_EQ(system.size(), 1u);
+	EXPECT_EQ(system.GetEnemy(0), other.get());
+	EXPECT_EQ(enemy->GetEnemySystem(), nullptr);
+
+	system.Clear();
+	EXPECT_EQ(other->GetEnemySystem(), nullptr);
+}
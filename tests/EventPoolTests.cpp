@@ -0,0 +1,91 @@
+#include "pch.h"
+#include <memory>
+
+#include "EnemyMovedEvent.h"
+#include "EventPool.h"
+#include "pickup.h"
+#include "PlayerCollidedWithEnemyEvent.h"
+#include "PlayerCollidedWithPickupEvent.h"
+#include "PooledEvents.h"
+#include "World.h"
+
+using namespace mazer;
+
+TEST(EventPoolTests, Reuses_Events_Nobody_Holds)
+{
+	EventPool<EnemyMovedEvent> pool;
+
+	auto first = pool.Acquire();
+	const auto* firstEvent = first.get();
+	const auto second = pool.Acquire();
+
+	// The first is still held, e.g. queued in the event manager
+	EXPECT_NE(second.get(), firstEvent);
+	EXPECT_EQ(pool.size(), 2u);
+
+	first.reset();
+	const auto third = pool.Acquire();
+	EXPECT_EQ(third.get(), firstEvent);
+	EXPECT_EQ(pool.size(), 2u);
+}
+
+TEST(EventPoolTests, Lets_Go_Of_What_Delivered_Events_Point_To)
+{
+	World world;
+	EventPool<PlayerCollidedWithPickupEvent> pool;
+	auto pickup = std::make_shared<Pickup>(true, world);
+	const std::weak_ptr<Pickup> watched = pickup;
+
+	auto delivered = pool.Acquire();
+	delivered->ThePickup = pickup;
+	auto queued = pool.Acquire();
+	queued->ThePickup = pickup;
+	pickup.reset();
+
+	// Nothing but the event manager holds a raised event, so letting go of it is delivering it
+	delivered.reset();
+	EXPECT_FALSE(watched.expired());
+	EXPECT_EQ(queued->ThePickup, watched.lock());
+
+	queued.reset();
+	EXPECT_TRUE(watched.expired());
+	EXPECT_EQ(pool.size(), 2u);
+}
+
+TEST(EventPoolTests, Events_Outlive_The_Pool)
+{
+	std::shared_ptr<EnemyMovedEvent> event;
+	{
+		EventPool<EnemyMovedEvent> pool;
+		event = pool.Acquire();
+	}
+
+	// e.g. still queued in the event manager when the world goes away
+	EXPECT_EQ(event->TheEnemy, nullptr);
+	event.reset();
+}
+
+TEST(EventPoolTests, World_Reuses_Player_Moved_Events_By_Direction)
+{
+	World world;
+	auto& pools = world.Pools();
+
+	auto up = pools.MakePlayerMovedEvent(gamelib::Direction::Up);
+	const auto* upEvent = up.get();
+	const auto down = pools.MakePlayerMovedEvent(gamelib::Direction::Down);
+	EXPECT_NE(down.get(), upEvent);
+	EXPECT_NE(pools.MakePlayerMovedEvent(gamelib::Direction::Up).get(), upEvent);
+
+	up.reset();
+	EXPECT_EQ(pools.MakePlayerMovedEvent(gamelib::Direction::Up).get(), upEvent);
+}
+
+TEST(EventPoolTests, EventAs_Casts_By_Event_Number)
+{
+	const std::shared_ptr<gamelib::Event> event = std::make_shared<EnemyMovedEvent>();
+
+	EXPECT_EQ(EventAs<EnemyMovedEvent>(event), event.get());
+	EXPECT_EQ(EventAs<PlayerCollidedWithEnemyEvent>(event), nullptr);
+	EXPECT_EQ(EventAs<PlayerCollidedWithPickupEvent>(event), nullptr);
+	EXPECT_EQ(EventAs<EnemyMovedEvent>(nullptr), nullptr);
+}
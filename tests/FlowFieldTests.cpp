@@ -0,0 +1,128 @@
+#include "pch.h"
+#include "FlowField.h"
+#include "MazeGrid.h"
+
+using namespace mazer;
+using namespace gamelib;
+
+namespace
+{
+	// A 1x4 corridor, open between each room
+	std::shared_ptr<MazeGrid> MakeCorridor()
+	{
+		auto grid = std::make_shared<MazeGrid>(1, 4);
+		for (auto i = 0; i < 3; i++) { grid->RemoveWall(i, Side::Right); }
+		return grid;
+	}
+}
+
+TEST(FlowFieldTests, Points_Along_The_Corridor_To_The_Target)
+{
+	const auto grid = MakeCorridor();
+	FlowField field;
+
+	field.SetTarget(grid, 3);
+
+	EXPECT_EQ(field.GetDistance(0), 3);
+	EXPECT_EQ(field.GetDistance(3), 0);
+	EXPECT_EQ(field.GetDirection(0), Direction::Right);
+	EXPECT_EQ(field.GetDirection(2), Direction::Right);
+	EXPECT_EQ(field.GetDirection(3), Direction::None);
+
+	field.SetTarget(grid, 0);
+
+	EXPECT_EQ(field.GetDistance(3), 3);
+	EXPECT_EQ(field.GetDirection(3), Direction::Left);
+	EXPECT_EQ(field.GetRebuildCount(), 2);
+}
+
+TEST(FlowFieldTests, Walled_Rooms_Are_Unreachable)
+{
+	const auto grid = std::make_shared<MazeGrid>(3, 3);
+	FlowField field;
+
+	field.SetTarget(grid, 4);
+
+	EXPECT_EQ(field.GetDistance(4), 0);
+	EXPECT_EQ(field.GetDistance(0), FlowField::Unreachable);
+	EXPECT_EQ(field.GetDirection(0), Direction::None);
+	EXPECT_EQ(field.GetDistance(-1), FlowField::Unreachable);
+	EXPECT_EQ(field.GetDirection(9), Direction::None);
+}
+
+TEST(FlowFieldTests, Same_Target_Does_Not_Rebuild)
+{
+	const auto grid = MakeCorridor();
+	FlowField field;
+
+	field.SetTarget(grid, 1);
+	field.SetTarget(grid, 1);
+
+	EXPECT_EQ(field.GetRebuildCount(), 1);
+}
+
+TEST(FlowFieldTests, Removing_A_Wall_Updates_Without_Rebuilding)
+{
+	// 2x3, open along the top row and down the right column only
+	//  0 1 2
+	//  3 4 5
+	const auto grid = std::make_shared<MazeGrid>(2, 3);
+	grid->RemoveWall(0, Side::Right);
+	grid->RemoveWall(1, Side::Right);
+	grid->RemoveWall(2, Side::Bottom);
+	grid->RemoveWall(5, Side::Left);
+	grid->RemoveWall(4, Side::Left);
+
+	FlowField field;
+	field.SetTarget(grid, 0);
+	EXPECT_EQ(field.GetDistance(3), 5);
+	EXPECT_EQ(field.GetDirection(3), Direction::Right);
+
+	// A shortcut from the target straight down
+	grid->RemoveWall(0, Side::Bottom);
+	field.OnWallRemoved(*grid, 0, Side::Bottom);
+
+	EXPECT_EQ(field.GetDistance(3), 1);
+	EXPECT_EQ(field.GetDirection(3), Direction::Up);
+	EXPECT_EQ(field.GetDistance(4), 2);
+	EXPECT_EQ(field.GetDirection(4), Direction::Left);
+	EXPECT_EQ(field.GetDistance(5), 3);
+	EXPECT_EQ(field.GetRebuildCount(), 1);
+
+	// Same as searching again from scratch
+	FlowField rebuilt;
+	rebuilt.SetTarget(grid, 0);
+	for (auto i = 0; i < grid->GetRoomCount(); i++)
+	{
+		EXPECT_EQ(field.GetDistance(i), rebuilt.GetDistance(i)) << "room " << i;
+	}
+}
+
+TEST(FlowFieldTests, Ignores_Changes_To_Other_Grids)
+{
+	const auto grid = MakeCorridor();
+	const auto other = MakeCorridor();
+	FlowField field;
+	field.SetTarget(grid, 0);
+
+	other->AddWall(1, Side::Right);
+	field.OnWallAdded(*other);
+	field.OnWallRemoved(*other, 0, Side::Bottom);
+
+	EXPECT_EQ(field.GetRebuildCount(), 1);
+	EXPECT_EQ(field.GetDistance(3), 3);
+}
+
+TEST(FlowFieldTests, Adding_A_Wall_Rebuilds)
+{
+	const auto grid = MakeCorridor();
+	FlowField field;
+	field.SetTarget(grid, 0);
+
+	grid->AddWall(1, Side::Right);
+	field.OnWallAdded(*grid);
+
+	EXPECT_EQ(field.GetDistance(1), 1);
+	EXPECT_EQ(field.GetDistance(2), FlowField::Unreachable);
+	EXPECT_EQ(field.GetRebuildCount(), 2);
+}
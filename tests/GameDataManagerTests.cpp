@@ -13,6 +13,7 @@
 #include <cppgamelib/events/AddGameObjectToCurrentSceneEvent.h>
 #include <cppgamelib/events/EventFactory.h>
 
+#include "EventNumber.h"
 #include "Level.h"
 #include "Player.h"
 #include "pickup.h"
@@ -95,6 +96,7 @@ TEST_F(GameDataManagerTests, Initialize)
 
 	EXPECT_TRUE(subject->SubscribesTo(gamelib::AddGameObjectToCurrentSceneEventId));
 	EXPECT_TRUE(subject->SubscribesTo(gamelib::GameObjectTypeEventId));
+	EXPECT_TRUE(subject->SubscribesTo(SettingsReloadedEventId));
 }
 
 TEST_F(GameDataManagerTests, InitialState)
@@ -155,6 +157,32 @@ TEST_F(GameDataManagerTests, Deletes_GameObject)
 	EXPECT_EQ(subject->TheGameData()->GameObjects.size(), 0) << "Expected 0 game object";
 }
 
+TEST_F(GameDataManagerTests, Reloading_Settings_Only_Swaps_The_Snapshot)
+{
+	EXPECT_CALL(*player, GetGameObjectType()).Times(testing::AtLeast(1)).WillRepeatedly(
+		testing::Return(gamelib::GameObjectType::game_defined));
+	subject->HandleEvent(std::dynamic_pointer_cast<gamelib::Event>(gamelib::EventFactory::CreateAddToSceneEvent(player)), 0);
+
+	// Settings are reloaded by the manager, not by each object subscribing to the reload
+	room->Initialize();
+	EXPECT_FALSE(room->SubscribesTo(SettingsReloadedEventId));
+	const auto offset = MazerSettings::Get()->Room.InnerBoundsOffset;
+	EXPECT_EQ(room->InnerBounds.x, offset);
+
+	// A room works out its inner bounds again when it next updates
+	auto changed = std::make_shared<MazerSettings>(*MazerSettings::Get());
+	changed->Room.InnerBoundsOffset = offset + 3;
+	MazerSettings::Set(changed);
+	room->Update(0);
+	EXPECT_EQ(room->InnerBounds.x, offset + 3);
+
+	// Nobody is told about the reload
+	EXPECT_CALL(*player, LoadSettings()).Times(0);
+	subject->HandleEvent(gamelib::EventFactory::Get()->CreateGenericEvent(SettingsReloadedEventId, "Tests"), 0);
+	room->Update(0);
+	EXPECT_EQ(room->InnerBounds.x, offset);
+}
+
 TEST_F(GameDataManagerTests, Subscriber_Name_Is_Correct)
 {
 	EXPECT_STREQ(subject->GetSubscriberName().c_str(), "GameDataManager") << "Unexpected Subscriber name";
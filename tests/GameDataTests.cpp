@@ -1,8 +1,11 @@
 #include "CharacterBuilder.h"
+#include "Enemy.h"
 #include "GameData.h"
 #include "Level.h"
 #include "Player.h"
 #include "Room.h"
+#include "RoomGenerator.h"
+#include "RoomInfo.h"
 #include "gtest/gtest.h"
 
 using namespace mazer;
@@ -13,6 +16,8 @@ class GameDataTests : public testing::Test
 
 	void SetUp() override
 	{
+		// The game data shares ownership of registered rooms, so start each test without any
+		GameData::Get()->Clear();
 		gamelib::ResourceManager::Get()->Initialize("Resources.xml");
 		level = std::make_shared<Level>();
 		room = std::make_shared<Room>("MyRoom", "Room", 1, 0, 0, 0, 0);
@@ -64,11 +69,40 @@ TEST_F(GameDataTests, Add_Remove_Pickup)
 	GameData::Get()->AddPickup(pickup);
 	EXPECT_EQ(GameData::Get()->CountPickups(), 1);
 	EXPECT_EQ(GameData::Get()->GameObjects.size(), 1);
+	EXPECT_EQ(GameData::Get()->GetPickupsInRoom(1).size(), 1);
 
 	GameData::Get()->RemovePickup(pickup);
 
 	EXPECT_EQ(GameData::Get()->CountPickups(), 0);
 	EXPECT_TRUE(GameData::Get()->GameObjects.empty());
+	EXPECT_TRUE(GameData::Get()->GetPickupsInRoom(1).empty());
+}
+
+TEST_F(GameDataTests, Enemies_Are_Kept_By_Room)
+{
+	GameData::Get()->Clear();
+
+	const RoomGenerator generator(100, 100, 10, 10, false);
+	const auto rooms = generator.Generate();
+	for (const auto& generatedRoom : rooms) { GameData::Get()->AddRoom(generatedRoom); }
+
+	const auto enemy = CharacterBuilder::BuildEnemy("MyEnemy", rooms[0], myResourceId, gamelib::Direction::Right, level);
+	enemy->Initialize();
+	GameData::Get()->AddEnemy(enemy);
+	EXPECT_EQ(GameData::Get()->GetEnemiesInRoom(0).size(), 1);
+
+	// Moving the enemy into the next room moves it to that room's bucket
+	auto placement = enemy->GetPlacement();
+	placement.X += 10;
+	enemy->SetPlacement(placement);
+	EXPECT_EQ(enemy->CurrentRoom->RoomIndex, 1);
+	EXPECT_TRUE(GameData::Get()->GetEnemiesInRoom(0).empty());
+	EXPECT_EQ(GameData::Get()->GetEnemiesInRoom(1).size(), 1);
+
+	GameData::Get()->RemoveEnemy(enemy);
+	EXPECT_TRUE(GameData::Get()->GetEnemiesInRoom(1).empty());
+
+	GameData::Get()->Clear();
 }
 
 
@@ -83,6 +117,37 @@ TEST_F(GameDataTests, Add_Remove_Room)
 	EXPECT_EQ(GameData::Get()->GetRoomByIndex(room->GetRoomNumber()), nullptr );
 }
 
+TEST_F(GameDataTests, Rooms_Are_Indexed_By_Room_Number)
+{
+	const RoomGenerator generator(100, 100, 3, 3, false);
+	const auto rooms = generator.Generate();
+	for (const auto& generatedRoom : rooms)
+	{
+		GameData::Get()->AddRoom(generatedRoom);
+	}
+
+	EXPECT_EQ(GameData::Get()->CountRooms(), 9);
+	EXPECT_EQ(GameData::Get()->GetRoom(4), rooms[4].get());
+	EXPECT_EQ(GameData::Get()->GetRoom(9), nullptr);
+	EXPECT_EQ(GameData::Get()->GetRoom(-1), nullptr);
+
+	// Neighbours are found by index
+	const RoomInfo roomInfo(rooms[4]);
+	EXPECT_EQ(roomInfo.GetTopRoom(), rooms[1].get());
+	EXPECT_EQ(roomInfo.GetRightRoom(), rooms[5].get());
+	EXPECT_EQ(roomInfo.GetBottomRoom(), rooms[7].get());
+	EXPECT_EQ(roomInfo.GetLeftRoom(), rooms[3].get());
+
+	GameData::Get()->RemoveRoom(rooms[4]);
+	EXPECT_EQ(GameData::Get()->CountRooms(), 8);
+	EXPECT_EQ(GameData::Get()->GetRoom(4), nullptr);
+	EXPECT_EQ(roomInfo.GetCurrentRoom(), nullptr);
+
+	GameData::Get()->Clear();
+	EXPECT_EQ(GameData::Get()->CountRooms(), 0);
+	EXPECT_EQ(GameData::Get()->GetRoom(0), nullptr);
+}
+
 TEST_F(GameDataTests, Add_Remove_GameObject)
 {
 	GameData::Get()->AddGameObject(room);
@@ -101,6 +166,60 @@ TEST_F(GameDataTests, GameData_Player)
 	EXPECT_FALSE(GameData::Get()->player.expired());
 }
 
+TEST_F(GameDataTests, Handles_Do_Not_Find_Removed_Objects)
+{
+	const auto enemy = CharacterBuilder::BuildEnemy("MyEnemy", room, myResourceId, gamelib::Direction::Down, level);
+	GameData::Get()->AddEnemy(enemy);
+	GameData::Get()->AddRoom(room);
+
+	const auto enemyHandle = enemy->Handle;
+	const auto roomHandle = room->Handle;
+	EXPECT_EQ(GameData::Get()->GetEnemy(enemyHandle), enemy.get());
+	EXPECT_EQ(GameData::Get()->GetRoom(roomHandle), room.get());
+	EXPECT_EQ(*GameData::Get()->Enemies().begin(), enemy.get());
+
+	GameData::Get()->RemoveEnemy(enemy);
+	GameData::Get()->RemoveRoom(room);
+	EXPECT_EQ(GameData::Get()->GetEnemy(enemyHandle), nullptr);
+	EXPECT_EQ(GameData::Get()->GetRoom(roomHandle), nullptr);
+
+	// Adding again issues a new handle, the old one stays stale
+	GameData::Get()->AddEnemy(enemy);
+	EXPECT_NE(enemy->Handle, enemyHandle);
+	EXPECT_EQ(GameData::Get()->GetEnemy(enemyHandle), nullptr);
+	EXPECT_EQ(GameData::Get()->GetEnemy(enemy->Handle), enemy.get());
+}
+
+TEST_F(GameDataTests, SetPlayer_Issues_A_Handle)
+{
+	const auto player = CharacterBuilder::BuildPlayer("MyPlayer", room, myResourceId, "StuNick");
+	GameData::Get()->SetPlayer(player);
+	EXPECT_EQ(GameData::Get()->GetPlayer(GameData::Get()->GetPlayerHandle()), player.get());
+	EXPECT_EQ(GameData::Get()->GetPlayer(), player);
+
+	// Building a player makes it the player of the game data
+	const auto oldHandle = GameData::Get()->GetPlayerHandle();
+	const auto otherPlayer = CharacterBuilder::BuildPlayer("OtherPlayer", room, myResourceId, "OtherNick");
+	EXPECT_EQ(GameData::Get()->GetPlayer(oldHandle), nullptr);
+	EXPECT_EQ(GameData::Get()->GetPlayer(GameData::Get()->GetPlayerHandle()), otherPlayer.get());
+}
+
+TEST_F(GameDataTests, Clear_Forgets_The_Player)
+{
+	auto player = CharacterBuilder::BuildPlayer("MyPlayer", room, myResourceId, "StuNick");
+	GameData::Get()->SetPlayer(player);
+	const auto handle = GameData::Get()->GetPlayerHandle();
+
+	// The level is torn down and its player destroyed
+	GameData::Get()->Clear();
+	player.reset();
+
+	EXPECT_FALSE(GameData::Get()->GetPlayerHandle().IsValid());
+	EXPECT_EQ(GameData::Get()->GetPlayer(handle), nullptr);
+	EXPECT_EQ(GameData::Get()->GetPlayer(GameData::Get()->GetPlayerHandle()), nullptr);
+	EXPECT_EQ(GameData::Get()->GetPlayer(), nullptr);
+}
+
 TEST_F(GameDataTests, SetGameWon)
 {
 	GameData::Get()->SetGameWon(true);
@@ -137,4 +256,29 @@ TEST_F(GameDataTests, RemoveExpiredReferences)
 	GameData::Get()->RemoveExpiredReferences();
 
 	EXPECT_EQ(GameData::Get()->GameObjects.size(), 1);
-}
\ No newline at end of file
+}
+
+TEST_F(GameDataTests, Locates_Rooms_By_Position)
+{
+	GameData::Get()->Clear();
+
+	const RoomGenerator generator(100, 100, 10, 10, false);
+	const auto rooms = generator.Generate();
+	for (const auto& generatedRoom : rooms)
+	{
+		GameData::Get()->AddRoom(generatedRoom);
+	}
+
+	EXPECT_EQ(GameData::Get()->GetRoomAt(5, 5), rooms[0].get());
+	EXPECT_EQ(GameData::Get()->GetRoomAt(95, 15), rooms[19].get());
+	EXPECT_EQ(GameData::Get()->GetRoomAt(100, 100), nullptr);
+
+	// A room info follows the position from room to room
+	RoomInfo roomInfo(rooms[0]);
+	EXPECT_FALSE(roomInfo.UpdateCurrentRoom(5, 5));
+	EXPECT_TRUE(roomInfo.UpdateCurrentRoom(15, 5));
+	EXPECT_EQ(roomInfo.RoomIndex, 1);
+	EXPECT_EQ(roomInfo.TheRoom, rooms[1]);
+
+	GameData::Get()->Clear();
+}
@@ -87,3 +87,35 @@ TEST_F(GameObjectMoveStrategyTests, BasicPositionChangedTest)
 	EXPECT_EQ(gameObject->Position.GetX(), initialPosition.GetX());
 	EXPECT_EQ(gameObject->Position.GetY(), initialPosition.GetY());
 }
+
+TEST_F(GameObjectMoveStrategyTests, Move_Permissions_Follow_Position_And_Walls)
+{
+	GameObjectMoveStrategy moveStrategy(gameObject, std::make_shared<mazer::RoomInfo>(room));
+	constexpr auto all = GameObjectMoveStrategy::CanMoveUp | GameObjectMoveStrategy::CanMoveDown |
+		GameObjectMoveStrategy::CanMoveLeft | GameObjectMoveStrategy::CanMoveRight;
+
+	// Away from the walls of the room, every way is open
+	gameObject->Bounds = { 40, 40, 20, 20 };
+	EXPECT_EQ(moveStrategy.GetMovePermissions(), all);
+
+	// Touching the top left corner, up and left are blocked
+	gameObject->Bounds = { 0, 0, 20, 20 };
+	EXPECT_EQ(moveStrategy.GetMovePermissions(), GameObjectMoveStrategy::CanMoveDown | GameObjectMoveStrategy::CanMoveRight);
+	EXPECT_FALSE(moveStrategy.CanGameObjectMove(gamelib::Direction::Up));
+	EXPECT_TRUE(moveStrategy.CanGameObjectMove(gamelib::Direction::Down));
+	EXPECT_TRUE(moveStrategy.CanGameObjectMove(gamelib::Direction::None));
+
+	// The right wall is at x = 100, so the last column of the bounds has to reach it
+	gameObject->Bounds = { 80, 40, 20, 20 };
+	EXPECT_TRUE(moveStrategy.CanGameObjectMove(gamelib::Direction::Right));
+	gameObject->Bounds = { 81, 40, 20, 20 };
+	EXPECT_FALSE(moveStrategy.CanGameObjectMove(gamelib::Direction::Right));
+
+	// Removing a wall opens the way without the game object moving
+	gameObject->Bounds = { 0, 0, 20, 20 };
+	EXPECT_FALSE(moveStrategy.CanGameObjectMove(gamelib::Direction::Up));
+	room->RemoveWall(gamelib::Side::Top);
+	EXPECT_TRUE(moveStrategy.CanGameObjectMove(gamelib::Direction::Up));
+	room->AddWall(gamelib::Side::Top);
+	EXPECT_FALSE(moveStrategy.CanGameObjectMove(gamelib::Direction::Up));
+}
@@ -0,0 +1,101 @@
+#include "pch.h"
+#include <memory>
+#include <vector>
+
+#include "GameObjectRegistry.h"
+
+using namespace mazer;
+
+namespace
+{
+	struct Object
+	{
+		explicit Object(const int id) : Id(id) {}
+		int Id;
+	};
+}
+
+TEST(GameObjectRegistryTests, AddFindRemove)
+{
+	GameObjectRegistry<Object> registry;
+	const auto first = std::make_shared<Object>(1);
+	const auto second = std::make_shared<Object>(2);
+
+	EXPECT_TRUE(registry.empty());
+	EXPECT_TRUE(registry.Add(first->Id, first));
+	EXPECT_TRUE(registry.Add(second->Id, second));
+
+	// Ids are unique
+	EXPECT_FALSE(registry.Add(first->Id, first));
+
+	EXPECT_EQ(registry.size(), 2u);
+	EXPECT_EQ(registry.Find(1), first);
+	EXPECT_EQ(registry.Find(2), second);
+	EXPECT_EQ(registry.Find(3), nullptr);
+
+	EXPECT_TRUE(registry.Remove(1));
+	EXPECT_FALSE(registry.Remove(1));
+	EXPECT_FALSE(registry.Contains(1));
+	EXPECT_EQ(registry.Find(2), second);
+	EXPECT_EQ(registry.size(), 1u);
+	EXPECT_EQ(registry[0].lock(), second);
+}
+
+TEST(GameObjectRegistryTests, ManyObjects)
+{
+	GameObjectRegistry<Object> registry;
+	std::vector<std::shared_ptr<Object>> objects;
+	constexpr auto count = 10000;
+
+	for (auto i = 0; i < count; i++)
+	{
+		objects.push_back(std::make_shared<Object>(i));
+		EXPECT_TRUE(registry.Add(i, objects.back()));
+	}
+
+	// Remove every other object, the rest must still be found
+	for (auto i = 0; i < count; i += 2)
+	{
+		EXPECT_TRUE(registry.Remove(i));
+	}
+
+	EXPECT_EQ(registry.size(), static_cast<std::size_t>(count / 2));
+	for (auto i = 0; i < count; i++)
+	{
+		EXPECT_EQ(registry.Contains(i), i % 2 == 1) << i;
+	}
+
+	// The dense array holds exactly the remaining objects
+	auto found = 0;
+	for (const auto& entry : registry)
+	{
+		const auto object = entry.lock();
+		ASSERT_NE(object, nullptr);
+		EXPECT_EQ(registry.Find(object->Id), object);
+		found++;
+	}
+	EXPECT_EQ(found, count / 2);
+}
+
+TEST(GameObjectRegistryTests, RemovesExpired)
+{
+	GameObjectRegistry<Object> registry;
+	const auto kept = std::make_shared<Object>(1);
+	registry.Add(kept->Id, kept);
+	{
+		const auto gone = std::make_shared<Object>(2);
+		registry.Add(gone->Id, gone);
+	}
+
+	EXPECT_EQ(registry.Find(2), nullptr);
+	EXPECT_EQ(registry.size(), 2u);
+
+	registry.RemoveExpired();
+	EXPECT_EQ(registry.size(), 1u);
+	EXPECT_FALSE(registry.Contains(2));
+	EXPECT_EQ(registry.Find(1), kept);
+
+	registry.clear();
+	EXPECT_TRUE(registry.empty());
+	EXPECT_FALSE(registry.Contains(1));
+}
@@ -0,0 +1,74 @@
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "JobSystem.h"
+
+using namespace mazer;
+
+TEST(JobSystemTests, Runs_Every_Index_Once)
+{
+	JobSystem jobs(4);
+	std::vector<int> visits(10007, 0);
+
+	jobs.ParallelFor(visits.size(), 64, [&](const std::size_t begin, const std::size_t end)
+		{
+			for (auto i = begin; i < end; i++) { visits[i]++; }
+		});
+
+	for (const auto visit : visits) { EXPECT_EQ(visit, 1); }
+	EXPECT_EQ(jobs.GetThreadCount(), 4u);
+}
+
+TEST(JobSystemTests, Runs_On_The_Calling_Thread_Alone)
+{
+	JobSystem jobs(1);
+	std::vector<std::size_t> values(100);
+
+	jobs.ParallelFor(values.size(), 7, [&](const std::size_t begin, const std::size_t end)
+		{
+			for (auto i = begin; i < end; i++) { values[i] = i * i; }
+		});
+
+	EXPECT_EQ(values[99], 99u * 99u);
+	EXPECT_EQ(jobs.GetSteals(), 0u);
+}
+
+TEST(JobSystemTests, Results_Do_Not_Depend_On_Thread_Count)
+{
+	// Each index writes its own slot, and the slots are combined in order afterwards
+	auto sum = [](const unsigned int threads)
+		{
+			JobSystem jobs(threads);
+			std::vector<double> slots(5000);
+			for (auto round = 0; round < 20; round++)
+			{
+				jobs.ParallelFor(slots.size(), 33, [&](const std::size_t begin, const std::size_t end)
+					{
+						for (auto i = begin; i < end; i++) { slots[i] = slots[i] * 0.5 + 1.0 / (i + round + 1.0); }
+					});
+			}
+			return std::accumulate(slots.begin(), slots.end(), 0.0);
+		};
+
+	EXPECT_EQ(sum(1), sum(3));
+	EXPECT_EQ(sum(1), sum(8));
+}
+
+TEST(JobSystemTests, Uneven_Work_Is_Shared_Out)
+{
+	JobSystem jobs(4);
+	std::atomic<int> done{ 0 };
+
+	// The first chunks are far slower than the rest, so idle threads take the rest from busy ones
+	jobs.ParallelFor(64, 1, [&](const std::size_t begin, const std::size_t)
+		{
+			if (begin < 4) { std::this_thread::sleep_for(std::chrono::milliseconds(20)); }
+			++done;
+		});
+
+	EXPECT_EQ(done.load(), 64);
+}
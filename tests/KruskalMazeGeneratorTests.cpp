@@ -0,0 +1,47 @@
+#include "pch.h"
+#include "KruskalMazeGenerator.h"
+#include "MazeGrid.h"
+#include "MazeTestHelpers.h"
+
+using namespace mazer;
+
+TEST(KruskalMazeGeneratorTests, GeneratesPerfectMaze)
+{
+	const auto grid = KruskalMazeGenerator(40, 70, 1234).GenerateGrid();
+
+	EXPECT_TRUE(tests::HasOuterWalls(*grid));
+	EXPECT_TRUE(tests::IsPerfectMaze(*grid));
+}
+
+TEST(KruskalMazeGeneratorTests, SameSeedSameMaze)
+{
+	const auto first = KruskalMazeGenerator(30, 30, 5, 0.25).GenerateGrid();
+	const auto second = KruskalMazeGenerator(30, 30, 5, 0.25).GenerateGrid();
+	const auto other = KruskalMazeGenerator(30, 30, 6, 0.25).GenerateGrid();
+
+	EXPECT_TRUE(tests::HaveSameWalls(*first, *second));
+	EXPECT_FALSE(tests::HaveSameWalls(*first, *other));
+}
+
+TEST(KruskalMazeGeneratorTests, BraidAddsLoops)
+{
+	constexpr auto rows = 50;
+	constexpr auto columns = 50;
+	constexpr auto innerWalls = rows * (columns - 1) + (rows - 1) * columns;
+	constexpr auto treeWalls = rows * columns - 1;
+
+	const auto grid = KruskalMazeGenerator(rows, columns, 99, 0.5).GenerateGrid();
+
+	// Still fully connected, with half of the walls a perfect maze would keep opened
+	EXPECT_EQ(tests::CountReachableRooms(*grid), rows * columns);
+	EXPECT_EQ(tests::CountOpenInnerWalls(*grid), treeWalls + (innerWalls - treeWalls + 1) / 2);
+	EXPECT_TRUE(tests::HasOuterWalls(*grid));
+}
+
+TEST(KruskalMazeGeneratorTests, FullBraidOpensEveryInnerWall)
+{
+	const auto grid = KruskalMazeGenerator(10, 12, 3, 1.0).GenerateGrid();
+
+	EXPECT_EQ(tests::CountOpenInnerWalls(*grid), 10 * 11 + 9 * 12);
+	EXPECT_TRUE(tests::HasOuterWalls(*grid));
+}
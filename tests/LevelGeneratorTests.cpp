@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "RoomGenerator.h"
+#include "MazeGrid.h"
 #include "Room.h"
 
 namespace LevelGenerator
@@ -12,4 +13,48 @@ namespace LevelGenerator
 		EXPECT_EQ(result[0]->GetTag(), "0") << "First room number tag not expected";
 		EXPECT_EQ(result[99]->GetTag(), "99") << "First room number tag not expected";
 	}
-}
\ No newline at end of file
+
+	TEST(LevelGeneratorTests, GenerateGrid)
+	{
+		const mazer::RoomGenerator levelGenerator(800, 600, 10, 20, true);
+		const auto grid = levelGenerator.GenerateGrid();
+		EXPECT_EQ(grid->GetRows(), 10);
+		EXPECT_EQ(grid->GetColumns(), 20);
+
+		// Rooms created over the grid are views of it
+		const auto rooms = levelGenerator.CreateRooms(grid);
+		EXPECT_EQ(rooms.size(), 200);
+		EXPECT_EQ(rooms[42]->GetGrid(), grid);
+		EXPECT_EQ(rooms[42]->GetNeighborIndex(gamelib::Side::Bottom), 62);
+	}
+
+	TEST(LevelGeneratorTests, EachRoomOpensOneOfItsOwnWalls)
+	{
+		const auto grid = mazer::RoomGenerator(800, 600, 30, 30, true, 1234).GenerateGrid();
+
+		auto openWalls = 0;
+		for (auto index = 0; index < grid->GetRoomCount(); index++)
+		{
+			const auto isOpen = !grid->IsWalled(index, gamelib::Side::Top) || !grid->IsWalled(index, gamelib::Side::Right)
+				|| !grid->IsWalled(index, gamelib::Side::Bottom) || !grid->IsWalled(index, gamelib::Side::Left);
+			EXPECT_TRUE(isOpen) << "Room " << index << " is walled in";
+
+			if (!grid->IsWalled(index, gamelib::Side::Right)) { openWalls++; }
+			if (!grid->IsWalled(index, gamelib::Side::Bottom)) { openWalls++; }
+		}
+
+		// Neighbors may open the same wall, but no room opens a wall of another
+		EXPECT_LE(openWalls, grid->GetRoomCount());
+	}
+
+	TEST(LevelGeneratorTests, SameSeedSameLevel)
+	{
+		const auto first = mazer::RoomGenerator(800, 600, 30, 30, true, 1234).GenerateGrid();
+		const auto second = mazer::RoomGenerator(800, 600, 30, 30, true, 1234).GenerateGrid();
+		const auto other = mazer::RoomGenerator(800, 600, 30, 30, true, 4321).GenerateGrid();
+
+		EXPECT_EQ(first->GetHorizontalWords(), second->GetHorizontalWords());
+		EXPECT_EQ(first->GetVerticalWords(), second->GetVerticalWords());
+		EXPECT_NE(first->GetVerticalWords(), other->GetVerticalWords());
+	}
+}
@@ -3,6 +3,8 @@
 
 #include "CharacterBuilder.h"
 #include "Level.h"
+#include "LevelBaker.h"
+#include "MazeGrid.h"
 #include "Room.h"
 #include "cppgamelib/events/AddGameObjectToCurrentSceneEvent.h"
 #include "cppgamelib/objects/GameObjectFactory.h"
@@ -73,4 +75,35 @@ TEST_F(LevelTesting, Test_AddGameObjectToScene)
 
 	// Ensure it raises the correct event
 	EXPECT_EQ(gamelib::EventManager::Get()->GetEvents().back()->Id, gamelib::AddGameObjectToCurrentSceneEventId);		
-}
\ No newline at end of file
+}
+
+TEST_F(LevelTesting, Test_LoadsBakedLevel)
+{
+	ASSERT_TRUE(mazer::LevelBaker::Bake("Level1.xml", "Level1.mzl"));
+
+	const auto bakedLevel = std::make_shared<mazer::Level>("Level1.mzl");
+	EXPECT_TRUE(bakedLevel->IsBinaryLevel());
+	EXPECT_FALSE(TheLevel->IsBinaryLevel());
+
+	TheLevel->Load();
+	bakedLevel->Load();
+
+	// The baked level is the same level
+	EXPECT_EQ(bakedLevel->NumCols, TheLevel->NumCols);
+	EXPECT_EQ(bakedLevel->NumRows, TheLevel->NumRows);
+	EXPECT_EQ(bakedLevel->Rooms.size(), TheLevel->Rooms.size());
+	EXPECT_EQ(bakedLevel->Grid->GetHorizontalWords(), TheLevel->Grid->GetHorizontalWords());
+	EXPECT_EQ(bakedLevel->Grid->GetVerticalWords(), TheLevel->Grid->GetVerticalWords());
+	EXPECT_EQ(bakedLevel->IsAutoPopulatePickups(), TheLevel->IsAutoPopulatePickups());
+
+	// Level1.xml has no seed, so neither level plays with a seed of 0
+	EXPECT_NE(bakedLevel->Seed, 0u);
+	EXPECT_NE(TheLevel->Seed, 0u);
+	ASSERT_EQ(bakedLevel->Pickups.size(), TheLevel->Pickups.size());
+
+	for (auto i = 0u; i < TheLevel->Pickups.size(); i++)
+	{
+		EXPECT_EQ(bakedLevel->Pickups[i]->GetName(), TheLevel->Pickups[i]->GetName());
+		EXPECT_EQ(bakedLevel->Pickups[i]->StringProperties, TheLevel->Pickups[i]->StringProperties);
+	}
+}
@@ -0,0 +1,123 @@
+#include "pch.h"
+#include "MazeGrid.h"
+#include "Room.h"
+
+using namespace mazer;
+
+TEST(MazeGridTests, Basic)
+{
+	const MazeGrid grid(3, 4);
+
+	EXPECT_EQ(grid.GetRows(), 3);
+	EXPECT_EQ(grid.GetColumns(), 4);
+	EXPECT_EQ(grid.GetRoomCount(), 12);
+	EXPECT_EQ(grid.GetIndex(2, 1), 9);
+	EXPECT_EQ(grid.GetRow(9), 2);
+	EXPECT_EQ(grid.GetColumn(9), 1);
+
+	// Expect all walls of all rooms to be walled by default
+	for (auto i = 0; i < grid.GetRoomCount(); i++)
+	{
+		EXPECT_TRUE(grid.IsWalled(i, gamelib::Side::Top));
+		EXPECT_TRUE(grid.IsWalled(i, gamelib::Side::Right));
+		EXPECT_TRUE(grid.IsWalled(i, gamelib::Side::Bottom));
+		EXPECT_TRUE(grid.IsWalled(i, gamelib::Side::Left));
+	}
+}
+
+TEST(MazeGridTests, Neighbors)
+{
+	const MazeGrid grid(3, 4);
+
+	// A room in the middle has all its neighbors
+	EXPECT_EQ(grid.GetNeighborIndex(5, gamelib::Side::Top), 1);
+	EXPECT_EQ(grid.GetNeighborIndex(5, gamelib::Side::Right), 6);
+	EXPECT_EQ(grid.GetNeighborIndex(5, gamelib::Side::Bottom), 9);
+	EXPECT_EQ(grid.GetNeighborIndex(5, gamelib::Side::Left), 4);
+
+	// Rooms on the edges have no neighbors beyond the edge
+	EXPECT_EQ(grid.GetNeighborIndex(0, gamelib::Side::Top), -1);
+	EXPECT_EQ(grid.GetNeighborIndex(0, gamelib::Side::Left), -1);
+	EXPECT_EQ(grid.GetNeighborIndex(3, gamelib::Side::Right), -1);
+	EXPECT_EQ(grid.GetNeighborIndex(11, gamelib::Side::Bottom), -1);
+	EXPECT_EQ(grid.GetNeighborIndex(4, gamelib::Side::Left), -1);
+}
+
+TEST(MazeGridTests, WallsAreShared)
+{
+	MazeGrid grid(3, 4);
+
+	// Removing a wall from one room removes it from the room on the other side too
+	grid.RemoveWall(5, gamelib::Side::Right);
+	EXPECT_FALSE(grid.IsWalled(5, gamelib::Side::Right));
+	EXPECT_FALSE(grid.IsWalled(6, gamelib::Side::Left));
+
+	grid.RemoveWall(5, gamelib::Side::Bottom);
+	EXPECT_FALSE(grid.IsWalled(5, gamelib::Side::Bottom));
+	EXPECT_FALSE(grid.IsWalled(9, gamelib::Side::Top));
+
+	// Other walls are untouched
+	EXPECT_TRUE(grid.IsWalled(5, gamelib::Side::Top));
+	EXPECT_TRUE(grid.IsWalled(5, gamelib::Side::Left));
+
+	grid.AddWall(6, gamelib::Side::Left);
+	EXPECT_TRUE(grid.IsWalled(5, gamelib::Side::Right));
+}
+
+TEST(MazeGridTests, Fill)
+{
+	MazeGrid grid(70, 130, false);
+
+	EXPECT_FALSE(grid.IsWalled(0, gamelib::Side::Top));
+	EXPECT_FALSE(grid.IsWalled(grid.GetRoomCount() - 1, gamelib::Side::Right));
+
+	grid.Fill(true);
+
+	EXPECT_TRUE(grid.IsWalled(0, gamelib::Side::Top));
+	EXPECT_TRUE(grid.IsWalled(grid.GetRoomCount() - 1, gamelib::Side::Right));
+	EXPECT_TRUE(grid.IsWalled(grid.GetRoomCount() - 1, gamelib::Side::Bottom));
+}
+
+TEST(MazeGridTests, VersionChangesWithTheWalls)
+{
+	MazeGrid grid(3, 4);
+	auto version = grid.GetVersion();
+
+	grid.RemoveWall(5, gamelib::Side::Right);
+	EXPECT_NE(grid.GetVersion(), version);
+	version = grid.GetVersion();
+
+	grid.Fill(true);
+	EXPECT_NE(grid.GetVersion(), version);
+	version = grid.GetVersion();
+
+	// Raw writes are counted once, when the writer is done
+	grid.SetVerticalWall(1, 2, false);
+	grid.SetHorizontalWall(1, 2, false);
+	EXPECT_EQ(grid.GetVersion(), version);
+	grid.MarkChanged();
+	EXPECT_NE(grid.GetVersion(), version);
+}
+
+TEST(MazeGridTests, IsCompact)
+{
+	const MazeGrid grid(1000, 1000);
+
+	// Roughly two bits per room
+	EXPECT_LT(grid.GetSizeInBytes(), 1000u * 1000u / 2u);
+}
+
+TEST(MazeGridTests, RoomsAreViewsOverTheGrid)
+{
+	const auto grid = std::make_shared<MazeGrid>(2, 2);
+	Room topLeft("Room0", "Room", grid, 0, 0, 0, 10, 10);
+	Room topRight("Room1", "Room", grid, 1, 10, 0, 10, 10);
+
+	EXPECT_EQ(topLeft.GetNeighborIndex(gamelib::Side::Right), 1);
+	EXPECT_EQ(topLeft.GetNeighborIndex(gamelib::Side::Left), -1);
+
+	// Removing a wall in one room is visible from the neighboring room
+	topLeft.RemoveWall(gamelib::Side::Right);
+	EXPECT_FALSE(topRight.IsWalled(gamelib::Side::Left));
+	EXPECT_FALSE(grid->IsWalled(1, gamelib::Side::Left));
+}
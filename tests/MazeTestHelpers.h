@@ -0,0 +1,74 @@
+#pragma once
+#include <queue>
+#include <vector>
+
+#include "MazeGrid.h"
+
+namespace mazer::tests
+{
+	// Number of open walls between rooms inside the maze
+	inline int CountOpenInnerWalls(const MazeGrid& grid)
+	{
+		auto open = 0;
+		for (auto i = 0; i < grid.GetRoomCount(); i++)
+		{
+			if (grid.GetNeighborIndex(i, gamelib::Side::Right) != -1 && !grid.IsWalled(i, gamelib::Side::Right)) { open++; }
+			if (grid.GetNeighborIndex(i, gamelib::Side::Bottom) != -1 && !grid.IsWalled(i, gamelib::Side::Bottom)) { open++; }
+		}
+		return open;
+	}
+
+	// Number of rooms that can be reached from the given room
+	inline int CountReachableRooms(const MazeGrid& grid, const int from = 0)
+	{
+		std::vector<bool> visited(grid.GetRoomCount());
+		std::queue<int> toVisit;
+		auto reached = 0;
+
+		visited[from] = true;
+		toVisit.push(from);
+
+		while (!toVisit.empty())
+		{
+			const auto room = toVisit.front();
+			toVisit.pop();
+			reached++;
+
+			for (const auto side : { gamelib::Side::Top, gamelib::Side::Right, gamelib::Side::Bottom, gamelib::Side::Left })
+			{
+				const auto neighbor = grid.GetNeighborIndex(room, side);
+				if (neighbor != -1 && !grid.IsWalled(room, side) && !visited[neighbor])
+				{
+					visited[neighbor] = true;
+					toVisit.push(neighbor);
+				}
+			}
+		}
+		return reached;
+	}
+
+	// A perfect maze has exactly one path between any two rooms: it is connected and has no loops
+	inline bool IsPerfectMaze(const MazeGrid& grid)
+	{
+		return CountReachableRooms(grid) == grid.GetRoomCount() && CountOpenInnerWalls(grid) == grid.GetRoomCount() - 1;
+	}
+
+	// The outer walls of the maze are all intact
+	inline bool HasOuterWalls(const MazeGrid& grid)
+	{
+		for (auto column = 0; column < grid.GetColumns(); column++)
+		{
+			if (!grid.HasHorizontalWall(0, column) || !grid.HasHorizontalWall(grid.GetRows(), column)) { return false; }
+		}
+		for (auto row = 0; row < grid.GetRows(); row++)
+		{
+			if (!grid.HasVerticalWall(row, 0) || !grid.HasVerticalWall(row, grid.GetColumns())) { return false; }
+		}
+		return true;
+	}
+
+	inline bool HaveSameWalls(const MazeGrid& first, const MazeGrid& second)
+	{
+		return first.GetHorizontalWords() == second.GetHorizontalWords() && first.GetVerticalWords() == second.GetVerticalWords();
+	}
+}
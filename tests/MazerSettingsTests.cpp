@@ -0,0 +1,61 @@
+#include "pch.h"
+#include <memory>
+
+#include "MazerSettings.h"
+
+using namespace mazer;
+
+TEST(MazerSettingsTests, ReadsTheSettingsFile)
+{
+	const auto settings = MazerSettings::Read();
+
+	EXPECT_EQ(settings->Grid.Rows, 10);
+	EXPECT_EQ(settings->Grid.Columns, 10);
+	EXPECT_TRUE(settings->Grid.RemoveSidesRandomly);
+	EXPECT_FALSE(settings->Grid.NoWalls);
+	EXPECT_EQ(settings->Room.InnerBoundsOffset, 2);
+	EXPECT_EQ(settings->Enemy.Speed, 2);
+	EXPECT_TRUE(settings->Enemy.MoveAtSpeed);
+	EXPECT_EQ(settings->Player.Speed, 3);
+	EXPECT_EQ(settings->Player.PixelsToMove, 1);
+	EXPECT_EQ(settings->Grid.Seed, 0u);
+}
+
+TEST(MazerSettingsTests, SwappingKeepsOldSnapshotsValid)
+{
+	const auto before = MazerSettings::Get();
+
+	auto changed = std::make_shared<MazerSettings>(*before);
+	changed->Grid.Rows = 99;
+	MazerSettings::Set(changed);
+
+	// Objects that loaded the old snapshot still see consistent, unchanged settings
+	EXPECT_EQ(MazerSettings::Get()->Grid.Rows, 99);
+	EXPECT_EQ(before->Grid.Rows, 10);
+
+	MazerSettings::Reload();
+	EXPECT_EQ(MazerSettings::Get()->Grid.Rows, 10);
+}
+
+TEST(MazerSettingsTests, CurrentSettingsFollowReloads)
+{
+	CurrentSettings settings;
+	EXPECT_EQ(settings->Grid.Rows, 0) << "Defaults until loaded";
+	EXPECT_FALSE(settings.Refresh());
+
+	settings.Load();
+	EXPECT_EQ(settings->Grid.Rows, 10);
+	EXPECT_FALSE(settings.Refresh());
+
+	auto changed = std::make_shared<MazerSettings>(*MazerSettings::Get());
+	changed->Grid.Rows = 99;
+	MazerSettings::Set(changed);
+	EXPECT_EQ(settings->Grid.Rows, 10) << "The snapshot held stays the same until refreshed";
+	EXPECT_TRUE(settings.Refresh());
+	EXPECT_EQ(settings->Grid.Rows, 99);
+	EXPECT_FALSE(settings.Refresh());
+
+	MazerSettings::Reload();
+	EXPECT_TRUE(settings.Refresh());
+	EXPECT_EQ(settings->Grid.Rows, 10);
+}
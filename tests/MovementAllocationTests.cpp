@@ -0,0 +1,127 @@
+#include "pch.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <cppgamelib/character/Hotspot.h>
+#include <cppgamelib/events/EventManager.h>
+
+#include "benchmarks/AllocationCounter.h"
+#include "CharacterBuilder.h"
+#include "Enemy.h"
+#include "EnemySystem.h"
+#include "GameData.h"
+#include "Level.h"
+#include "MazeGrid.h"
+#include "MazerSettings.h"
+#include "Player.h"
+#include "Room.h"
+#include "RoomGenerator.h"
+#include "Simulation.h"
+#include "World.h"
+#include "cppgamelib/resource/ResourceManager.h"
+
+using namespace mazer;
+using mazer::benchmarks::AllocationCounter;
+
+class MovementAllocationTests : public testing::Test
+{
+public:
+	void SetUp() override
+	{
+		gamelib::ResourceManager::Get()->Initialize("Resources.xml");
+
+		// Enemies raise a move event every time they move, the most events a tick can have
+		auto settings = std::make_shared<MazerSettings>(*MazerSettings::Get());
+		settings->Enemy.EmitMoveEvents = true;
+		MazerSettings::Set(settings);
+
+		// Three rooms in a row, open to each other
+		const auto grid = std::make_shared<MazeGrid>(1, 3);
+		grid->RemoveWall(0, gamelib::Side::Right);
+		grid->RemoveWall(1, gamelib::Side::Right);
+
+		const RoomGenerator generator(600, 200, 1, 3, false, 1);
+		level = std::make_shared<Level>(world);
+		level->Grid = grid;
+		level->Rooms = generator.CreateRooms(grid, world);
+		for (const auto& room : level->Rooms) { world.Data().AddRoom(room); }
+		simulation = std::make_unique<Simulation>(level);
+	}
+
+	void TearDown() override
+	{
+		MazerSettings::Reload();
+		gamelib::EventManager::Get()->Reset();
+	}
+
+	World world;
+	std::shared_ptr<Level> level;
+	std::unique_ptr<Simulation> simulation;
+	int enemyResourceId = 18;
+	int playerResourceId = 188;
+};
+
+TEST_F(MovementAllocationTests, Ticks_Allocate_Nothing_Once_Running)
+{
+	constexpr auto enemyCount = 100;
+	constexpr std::uint64_t ticks = 10000;
+	constexpr gamelib::Direction directions[] = { gamelib::Direction::Up, gamelib::Direction::Right,
+		gamelib::Direction::Down, gamelib::Direction::Left };
+
+	// The player is the player of the world, so enemies chase it and it collides with them
+	const auto player = simulation->SpawnPlayer(playerResourceId, 1);
+	ASSERT_NE(player, nullptr);
+	ASSERT_EQ(world.Data().GetPlayer(), player);
+
+	for (auto i = 0; i < enemyCount; i++)
+	{
+		auto enemy = CharacterBuilder::BuildEnemy("Enemy", level->Rooms[i % 3], enemyResourceId, directions[i % 4], level,
+			world);
+		enemy->Initialize();
+		world.Data().AddEnemy(enemy);
+	}
+	simulation->BatchEnemies();
+
+	// The player runs one way along the corridor and then back, over and over
+	simulation->SetInput([](const std::uint64_t tick)
+		{
+			return tick / 150 % 2 == 0 ? gamelib::Direction::Right : gamelib::Direction::Left;
+		});
+
+	const auto& enemies = *simulation->GetEnemySystem();
+	std::vector<int> enemyXs(enemies.size());
+	std::vector<int> enemyYs(enemies.size());
+	std::uint64_t playerMovesLeft = 0;
+	std::uint64_t playerMovesRight = 0;
+	std::uint64_t enemyMoves = 0;
+	auto tick = [&]
+		{
+			const auto playerX = player->Hotspot->GetBounds().x;
+			simulation->Tick();
+
+			const auto movedX = player->Hotspot->GetBounds().x - playerX;
+			if (movedX < 0) { playerMovesLeft++; }
+			if (movedX > 0) { playerMovesRight++; }
+
+			for (std::size_t i = 0; i < enemies.size(); i++)
+			{
+				if (enemies.GetX(i) != enemyXs[i] || enemies.GetY(i) != enemyYs[i]) { enemyMoves++; }
+				enemyXs[i] = enemies.GetX(i);
+				enemyYs[i] = enemies.GetY(i);
+			}
+		};
+
+	// By now the rooms have held the most enemies they will, and every pool has as many events as are in flight
+	for (auto i = 0; i < 2000; i++) { tick(); }
+	playerMovesLeft = playerMovesRight = enemyMoves = 0;
+
+	AllocationCounter::Reset();
+	for (std::uint64_t i = 0; i < ticks; i++) { tick(); }
+	const auto allocations = AllocationCounter::GetCount();
+
+	EXPECT_EQ(allocations, 0u);
+	EXPECT_EQ(enemies.size(), static_cast<std::size_t>(enemyCount));
+	EXPECT_GT(playerMovesLeft, ticks / 20);
+	EXPECT_GT(playerMovesRight, ticks / 20);
+	EXPECT_GT(enemyMoves, ticks);
+}
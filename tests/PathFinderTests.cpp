@@ -0,0 +1,105 @@
+#include "pch.h"
+#include "FlowField.h"
+#include "KruskalMazeGenerator.h"
+#include "MazeGrid.h"
+#include "PathFinder.h"
+
+using namespace mazer;
+using namespace gamelib;
+
+namespace
+{
+	// Whether each step of the path is to a neighbouring room through an open wall
+	bool IsWalkable(const MazeGrid& grid, const std::vector<int>& path)
+	{
+		for (std::size_t i = 1; i < path.size(); i++)
+		{
+			auto open = false;
+			for (const auto side : { Side::Top, Side::Right, Side::Bottom, Side::Left })
+			{
+				open = open || (grid.GetNeighborIndex(path[i - 1], side) == path[i] && !grid.IsWalled(path[i - 1], side));
+			}
+			if (!open) { return false; }
+		}
+		return true;
+	}
+}
+
+TEST(PathFinderTests, Finds_The_Way_Along_A_Corridor)
+{
+	auto grid = std::make_shared<MazeGrid>(1, 4);
+	for (auto i = 0; i < 3; i++) { grid->RemoveWall(i, Side::Right); }
+
+	for (const auto search : { PathFinder::Search::AStar, PathFinder::Search::JumpPoint })
+	{
+		PathFinder finder(grid, search);
+		std::vector<int> path;
+
+		EXPECT_TRUE(finder.FindPath(3, 0, path));
+		EXPECT_EQ(path, std::vector<int>({ 3, 2, 1, 0 }));
+
+		EXPECT_TRUE(finder.FindPath(2, 2, path));
+		EXPECT_EQ(path, std::vector<int>({ 2 }));
+	}
+}
+
+TEST(PathFinderTests, No_Path_Through_Walls)
+{
+	const auto grid = std::make_shared<MazeGrid>(3, 3);
+
+	for (const auto search : { PathFinder::Search::AStar, PathFinder::Search::JumpPoint })
+	{
+		PathFinder finder(grid, search);
+		std::vector<int> path = { 1, 2, 3 };
+
+		EXPECT_FALSE(finder.FindPath(0, 8, path));
+		EXPECT_TRUE(path.empty());
+		EXPECT_FALSE(finder.FindPath(0, 9, path));
+	}
+}
+
+TEST(PathFinderTests, Paths_Are_Shortest)
+{
+	// Loops in the maze give more than one way between rooms
+	const KruskalMazeGenerator generator(24, 24, 99, 0.2);
+	const auto grid = generator.GenerateGrid();
+
+	PathFinder aStar(grid);
+	PathFinder jumpPoint(grid, PathFinder::Search::JumpPoint);
+	FlowField distances;
+	std::vector<int> path;
+
+	for (auto from = 0; from < grid->GetRoomCount(); from += 37)
+	{
+		for (auto to = 0; to < grid->GetRoomCount(); to += 53)
+		{
+			distances.SetTarget(grid, to);
+			const auto length = static_cast<std::size_t>(distances.GetDistance(from)) + 1;
+
+			EXPECT_TRUE(aStar.FindPath(from, to, path));
+			EXPECT_EQ(path.size(), length);
+			EXPECT_EQ(path.front(), from);
+			EXPECT_EQ(path.back(), to);
+			EXPECT_TRUE(IsWalkable(*grid, path));
+
+			EXPECT_TRUE(jumpPoint.FindPath(from, to, path));
+			EXPECT_EQ(path.size(), length);
+			EXPECT_EQ(path.front(), from);
+			EXPECT_EQ(path.back(), to);
+			EXPECT_TRUE(IsWalkable(*grid, path));
+		}
+	}
+}
+
+TEST(PathFinderTests, Jump_Point_Search_Expands_Fewer_Rooms)
+{
+	const KruskalMazeGenerator generator(32, 32, 7);
+	const auto grid = generator.GenerateGrid();
+	PathFinder aStar(grid);
+	PathFinder jumpPoint(grid, PathFinder::Search::JumpPoint);
+	std::vector<int> path;
+
+	EXPECT_TRUE(aStar.FindPath(0, grid->GetRoomCount() - 1, path));
+	EXPECT_TRUE(jumpPoint.FindPath(0, grid->GetRoomCount() - 1, path));
+	EXPECT_LT(jumpPoint.GetExpanded(), aStar.GetExpanded());
+}
@@ -0,0 +1,85 @@
+#include "pch.h"
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "RandomStream.h"
+
+using namespace mazer;
+
+TEST(RandomStreamTests, SameKeySameNumbers)
+{
+	RandomStream first(42);
+	RandomStream second(42);
+
+	for (auto i = 0; i < 100; i++)
+	{
+		EXPECT_EQ(first(), second());
+	}
+}
+
+TEST(RandomStreamTests, KnownSequence)
+{
+	// The sequence must never change, or levels saved with a seed would no longer reproduce. These are the first
+	// numbers of SplitMix64 seeded with 0.
+	RandomStream random(0);
+
+	EXPECT_EQ(random(), 0xE220A8397B1DCDAFull);
+	EXPECT_EQ(random(), 0x6E789E6AA1B965F4ull);
+	EXPECT_EQ(random(), 0x06C45D188009454Full);
+}
+
+TEST(RandomStreamTests, AtIsRandomAccess)
+{
+	RandomStream random(7);
+	const auto fifth = random.At(4);
+
+	for (auto i = 0; i < 4; i++) { random(); }
+
+	EXPECT_EQ(random(), fifth);
+	EXPECT_EQ(random.GetCounter(), 5u);
+}
+
+TEST(RandomStreamTests, DerivedStreamsAreIndependent)
+{
+	const RandomStream level(1234);
+
+	EXPECT_NE(level.Derive(RandomDomain::Rooms, 1).At(0), level.Derive(RandomDomain::Rooms, 2).At(0));
+	EXPECT_NE(level.Derive(RandomDomain::Rooms, 1).At(0), level.Derive(RandomDomain::Enemies, 1).At(0));
+	EXPECT_EQ(level.Derive(RandomDomain::Enemies, 3).At(0), RandomStream(1234).Derive(RandomDomain::Enemies, 3).At(0));
+}
+
+TEST(RandomStreamTests, NextIntIsInRange)
+{
+	RandomStream random(99);
+	std::vector<int> counts(6);
+
+	for (auto i = 0; i < 60000; i++)
+	{
+		const auto value = random.NextInt(6);
+		ASSERT_GE(value, 0);
+		ASSERT_LT(value, 6);
+		counts[value]++;
+	}
+
+	// Roughly uniform
+	for (const auto count : counts)
+	{
+		EXPECT_GT(count, 9000);
+		EXPECT_LT(count, 11000);
+	}
+}
+
+TEST(RandomStreamTests, ShuffleIsReproducible)
+{
+	std::vector<int> first(50);
+	std::iota(first.begin(), first.end(), 0);
+	auto second = first;
+
+	RandomStream(5).Shuffle(first.begin(), first.end());
+	RandomStream(5).Shuffle(second.begin(), second.end());
+
+	EXPECT_EQ(first, second);
+	EXPECT_TRUE(std::is_permutation(first.begin(), first.end(), second.begin()));
+	EXPECT_FALSE(std::is_sorted(first.begin(), first.end()));
+}
@@ -0,0 +1,67 @@
+#include "pch.h"
+#include <cstdint>
+#include <vector>
+#include "RoomBuckets.h"
+
+using namespace mazer;
+
+namespace
+{
+	SlotHandle Handle(const std::uint32_t index) { return { index, 0 }; }
+}
+
+TEST(RoomBucketsTests, Keeps_Handles_By_Room)
+{
+	RoomBuckets buckets;
+	buckets.Add(3, Handle(1));
+	buckets.Add(3, Handle(2));
+	buckets.Add(0, Handle(3));
+
+	EXPECT_EQ(buckets.size(), 3u);
+	EXPECT_EQ(buckets.Get(3).size(), 2u);
+	EXPECT_EQ(buckets.Get(0).front(), Handle(3));
+	EXPECT_TRUE(buckets.Get(1).empty());
+	EXPECT_TRUE(buckets.Get(100).empty());
+	EXPECT_TRUE(buckets.Get(-1).empty());
+
+	EXPECT_TRUE(buckets.Remove(3, Handle(1)));
+	EXPECT_FALSE(buckets.Remove(3, Handle(1)));
+	EXPECT_FALSE(buckets.Remove(0, Handle(2)));
+	EXPECT_EQ(buckets.Get(3), std::vector<SlotHandle>({ Handle(2) }));
+	EXPECT_EQ(buckets.size(), 2u);
+
+	buckets.Clear();
+	EXPECT_TRUE(buckets.empty());
+	EXPECT_TRUE(buckets.Get(3).empty());
+}
+
+TEST(RoomBucketsTests, Moves_Handles_Between_Rooms)
+{
+	RoomBuckets buckets;
+	buckets.Add(0, Handle(1));
+
+	buckets.Move(Handle(1), 0, 5);
+	EXPECT_TRUE(buckets.Get(0).empty());
+	EXPECT_EQ(buckets.Get(5), std::vector<SlotHandle>({ Handle(1) }));
+
+	// Only a handle in the room it moves from is moved
+	buckets.Move(Handle(2), 0, 5);
+	buckets.Move(Handle(1), 0, 6);
+	EXPECT_EQ(buckets.Get(5).size(), 1u);
+	EXPECT_TRUE(buckets.Get(6).empty());
+	EXPECT_EQ(buckets.size(), 1u);
+}
+
+TEST(RoomBucketsTests, Removes_Handles_Matching_A_Predicate)
+{
+	RoomBuckets buckets;
+	for (std::uint32_t i = 0; i < 10; i++) { buckets.Add(static_cast<int>(i % 3), Handle(i)); }
+
+	buckets.RemoveIf([](const SlotHandle handle) { return handle.Index % 2 == 0; });
+
+	EXPECT_EQ(buckets.size(), 5u);
+	for (auto room = 0; room < 3; room++)
+	{
+		for (const auto handle : buckets.Get(room)) { EXPECT_EQ(handle.Index % 2, 1u); }
+	}
+}
@@ -0,0 +1,69 @@
+#include "pch.h"
+#include <vector>
+#include "RoomLocator.h"
+
+using namespace mazer;
+
+TEST(RoomLocatorTests, LocatesRooms)
+{
+	// 3 rows of 4 rooms, each 10 wide and 20 high
+	const RoomLocator locator(3, 4, 10, 20);
+
+	EXPECT_TRUE(locator.IsValid());
+	EXPECT_EQ(locator.GetRoomIndex(0, 0), 0);
+	EXPECT_EQ(locator.GetRoomIndex(9, 19), 0);
+	EXPECT_EQ(locator.GetRoomIndex(10, 0), 1);
+	EXPECT_EQ(locator.GetRoomIndex(15, 25), 5);
+	EXPECT_EQ(locator.GetRoomIndex(39, 59), 11);
+}
+
+TEST(RoomLocatorTests, OutsideTheMaze)
+{
+	const RoomLocator locator(3, 4, 10, 20);
+
+	EXPECT_EQ(locator.GetRoomIndex(-1, 0), -1);
+	EXPECT_EQ(locator.GetRoomIndex(0, -1), -1);
+	EXPECT_EQ(locator.GetRoomIndex(40, 0), -1);
+	EXPECT_EQ(locator.GetRoomIndex(0, 60), -1);
+}
+
+TEST(RoomLocatorTests, Origin)
+{
+	const RoomLocator locator(2, 2, 10, 10, 100, 50);
+
+	EXPECT_EQ(locator.GetRoomIndex(100, 50), 0);
+	EXPECT_EQ(locator.GetRoomIndex(115, 65), 3);
+	EXPECT_EQ(locator.GetRoomIndex(99, 50), -1);
+}
+
+TEST(RoomLocatorTests, LocatesNothingWithoutALayout)
+{
+	const RoomLocator locator;
+
+	EXPECT_FALSE(locator.IsValid());
+	EXPECT_EQ(locator.GetRoomIndex(0, 0), -1);
+}
+
+TEST(RoomLocatorTests, RoomsOverlappingARectangle)
+{
+	const RoomLocator locator(3, 4, 10, 20);
+	std::vector<int> rooms;
+	const auto collect = [&rooms](const int room) { rooms.push_back(room); };
+
+	// Inside one room, across the corner of four, and hanging off the edge of the maze
+	locator.ForEachRoomOverlapping(2, 2, 5, 5, collect);
+	EXPECT_EQ(rooms, std::vector<int>({ 0 }));
+
+	rooms.clear();
+	locator.ForEachRoomOverlapping(15, 15, 10, 10, collect);
+	EXPECT_EQ(rooms, std::vector<int>({ 1, 2, 5, 6 }));
+
+	rooms.clear();
+	locator.ForEachRoomOverlapping(-5, 55, 10, 10, collect);
+	EXPECT_EQ(rooms, std::vector<int>({ 8 }));
+
+	rooms.clear();
+	locator.ForEachRoomOverlapping(40, 0, 10, 10, collect);
+	locator.ForEachRoomOverlapping(-10, 0, 10, 10, collect);
+	EXPECT_TRUE(rooms.empty());
+}
@@ -1,5 +1,7 @@
 #include "pch.h"
 #include "Room.h"
+#include "EnemyMovedEvent.h"
+#include <cppgamelib/events/PlayerMovedEvent.h>
 
 using namespace mazer;
 
@@ -105,4 +107,14 @@ TEST(RoomTests, AddWalls)
 	EXPECT_TRUE(room.IsWalled(gamelib::Side::Top));
 	EXPECT_TRUE(room.IsWalled(gamelib::Side::Left));
 	EXPECT_TRUE(room.IsWalled(gamelib::Side::Right));
-}
\ No newline at end of file
+}
+
+TEST(RoomTests, DoesNotListenForMoves)
+{
+	const auto room = std::make_shared<Room>("roomName", "Room", 1, 0, 0, 10, 10, false);
+	room->Initialize();
+
+	// Players and enemies find their own room, so a move costs the same however many rooms there are
+	EXPECT_FALSE(room->SubscribesTo(gamelib::PlayerMovedEventTypeEventId));
+	EXPECT_FALSE(room->SubscribesTo(EnemyMovedEventId));
+}
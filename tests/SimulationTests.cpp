@@ -0,0 +1,168 @@
+#include <cppgamelib/events/EventManager.h>
+#include <gtest/gtest.h>
+
+#include "CharacterBuilder.h"
+#include "Enemy.h"
+#include "EnemySystem.h"
+#include "GameData.h"
+#include "JobSystem.h"
+#include "Level.h"
+#include "pickup.h"
+#include "Player.h"
+#include "RoomInfo.h"
+#include "Simulation.h"
+#include "World.h"
+#include "cppgamelib/resource/ResourceManager.h"
+
+using namespace mazer;
+
+namespace
+{
+	// FNV-1a over where everything in the world is
+	class WorldHash
+	{
+	public:
+		void Add(const std::int64_t value)
+		{
+			hash = (hash ^ static_cast<std::uint64_t>(value)) * 1099511628211ull;
+		}
+
+		[[nodiscard]] std::uint64_t Get() const { return hash; }
+
+	private:
+		std::uint64_t hash = 14695981039346656037ull;
+	};
+
+	std::uint64_t HashWorld(const Simulation& simulation, const World& world)
+	{
+		WorldHash hash;
+		const auto& gameData = world.Data();
+
+		if (const auto player = gameData.GetPlayer(gameData.GetPlayerHandle()))
+		{
+			hash.Add(player->Position.GetX());
+			hash.Add(player->Position.GetY());
+			hash.Add(player->CurrentRoom->RoomIndex);
+		}
+
+		const auto& enemies = *simulation.GetEnemySystem();
+		hash.Add(static_cast<std::int64_t>(enemies.size()));
+		for (std::size_t i = 0; i < enemies.size(); i++)
+		{
+			hash.Add(enemies.GetX(i));
+			hash.Add(enemies.GetY(i));
+			hash.Add(enemies.GetRoom(i));
+			hash.Add(static_cast<std::int64_t>(enemies.GetDirection(i)));
+		}
+
+		hash.Add(gameData.CountPickups());
+		for (const auto pickup : gameData.Pickups())
+		{
+			hash.Add(pickup->Position.GetX());
+			hash.Add(pickup->Position.GetY());
+		}
+		return hash.Get();
+	}
+}
+
+class SimulationTests : public testing::Test
+{
+public:
+	void SetUp() override
+	{
+		gamelib::ResourceManager::Get()->Initialize("Resources.xml");
+	}
+
+	void TearDown() override
+	{
+		gamelib::EventManager::Get()->Reset();
+	}
+
+	World world;
+	int playerResourceId = 188;
+};
+
+TEST_F(SimulationTests, Loads_Level_Into_Its_World)
+{
+	Simulation simulation(std::make_shared<Level>("Level1.xml", world));
+	simulation.Load();
+
+	EXPECT_EQ(world.Data().CountRooms(), 100);
+	EXPECT_EQ(world.Data().CountPickups(), 12u);
+	EXPECT_EQ(GameData::Get()->CountPickups(), 0u);
+
+	const auto player = simulation.SpawnPlayer(playerResourceId, 5);
+	ASSERT_NE(player, nullptr);
+	EXPECT_EQ(world.Data().GetPlayer(), player);
+	EXPECT_EQ(player->CurrentRoom->RoomIndex, 5);
+}
+
+TEST_F(SimulationTests, Runs_Fixed_Number_Of_Ticks)
+{
+	Simulation simulation(std::make_shared<Level>("Level1.xml", world), 10);
+	simulation.Load();
+	simulation.SpawnPlayer(playerResourceId);
+	simulation.SetInput(Simulation::RandomInput(1234, 5));
+
+	const auto report = simulation.Run(200);
+
+	EXPECT_EQ(report.Ticks, 200u);
+	EXPECT_EQ(report.SimulatedMs, 2000u);
+	EXPECT_EQ(simulation.GetTick(), 200u);
+	EXPECT_GE(report.Seconds, 0.0);
+	EXPECT_LE(world.Data().CountPickups(), 12u);
+}
+
+TEST_F(SimulationTests, Random_Input_Is_Reproducible)
+{
+	const auto input = Simulation::RandomInput(42, 10);
+	const auto sameInput = Simulation::RandomInput(42, 10);
+
+	auto changes = 0;
+	for (std::uint64_t tick = 0; tick < 1000; tick++)
+	{
+		EXPECT_EQ(input(tick), sameInput(tick));
+		if (tick % 10 != 0) { EXPECT_EQ(input(tick), input(tick - 1)); }
+		else if (tick > 0 && input(tick) != input(tick - 1)) { changes++; }
+	}
+	EXPECT_GT(changes, 0);
+}
+
+TEST_F(SimulationTests, Parallel_Ticks_Match_Serial_Ticks)
+{
+	constexpr gamelib::Direction directions[] = { gamelib::Direction::Up, gamelib::Direction::Right,
+		gamelib::Direction::Down, gamelib::Direction::Left };
+
+	auto run = [&](World& runWorld, JobSystem* jobs)
+		{
+			gamelib::EventManager::Get()->Reset();
+
+			Simulation simulation(std::make_shared<Level>("Level1.xml", runWorld), 10);
+			simulation.Load();
+			simulation.SpawnPlayer(playerResourceId);
+
+			// Enemies all over the level, more than one job's worth
+			const auto& level = simulation.GetLevel();
+			for (auto i = 0; i < 600; i++)
+			{
+				const auto& room = level->Rooms[(i * 7 + 3) % level->Rooms.size()];
+				auto enemy = CharacterBuilder::BuildEnemy("Enemy", room, 18, directions[i % 4], level, runWorld);
+				enemy->Initialize();
+				runWorld.Data().AddEnemy(enemy);
+				level->Enemies.push_back(enemy);
+			}
+
+			simulation.BatchEnemies();
+			simulation.SetJobSystem(jobs);
+			simulation.SetInput(Simulation::RandomInput(1234, 5));
+			simulation.Run(300);
+			return HashWorld(simulation, runWorld);
+		};
+
+	World parallelWorld;
+	JobSystem jobs(4);
+	const auto serial = run(world, nullptr);
+	const auto parallel = run(parallelWorld, &jobs);
+
+	EXPECT_EQ(serial, parallel);
+}
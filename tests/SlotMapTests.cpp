@@ -0,0 +1,112 @@
+#include "pch.h"
+#include <memory>
+#include <vector>
+
+#include "SlotMap.h"
+
+using namespace mazer;
+
+TEST(SlotMapTests, InsertGetRemove)
+{
+	SlotMap<int> map;
+	const auto first = std::make_shared<int>(1);
+	const auto second = std::make_shared<int>(2);
+
+	const auto firstHandle = map.Insert(first);
+	const auto secondHandle = map.Insert(second);
+
+	EXPECT_EQ(map.size(), 2u);
+	EXPECT_EQ(map.Get(firstHandle), first.get());
+	EXPECT_EQ(map.Get(secondHandle), second.get());
+	EXPECT_EQ(map.Lock(secondHandle), second);
+
+	EXPECT_TRUE(map.Remove(firstHandle));
+	EXPECT_FALSE(map.Remove(firstHandle));
+	EXPECT_EQ(map.Get(firstHandle), nullptr);
+	EXPECT_EQ(map.Get(secondHandle), second.get());
+	EXPECT_EQ(map.size(), 1u);
+	EXPECT_EQ(map[0], second.get());
+}
+
+TEST(SlotMapTests, StaleHandlesDoNotFindReusedSlots)
+{
+	SlotMap<int> map;
+	const auto first = std::make_shared<int>(1);
+	const auto second = std::make_shared<int>(2);
+
+	const auto firstHandle = map.Insert(first);
+	map.Remove(firstHandle);
+
+	// The slot is reused, but with a new generation
+	const auto secondHandle = map.Insert(second);
+	EXPECT_EQ(secondHandle.Index, firstHandle.Index);
+	EXPECT_NE(secondHandle, firstHandle);
+	EXPECT_EQ(map.Get(firstHandle), nullptr);
+	EXPECT_EQ(map.Get(secondHandle), second.get());
+
+	EXPECT_EQ(map.Get(SlotHandle{}), nullptr);
+	EXPECT_FALSE(SlotHandle{}.IsValid());
+
+	map.clear();
+	EXPECT_TRUE(map.empty());
+	EXPECT_EQ(map.Get(secondHandle), nullptr);
+}
+
+TEST(SlotMapTests, IteratesOverContiguousObjects)
+{
+	SlotMap<int> map;
+	std::vector<std::shared_ptr<int>> values;
+	std::vector<SlotHandle> handles;
+
+	for (auto i = 0; i < 100; i++)
+	{
+		values.push_back(std::make_shared<int>(i));
+		handles.push_back(map.Insert(values.back()));
+	}
+
+	for (auto i = 0; i < 100; i += 3)
+	{
+		map.Remove(handles[i]);
+	}
+
+	auto sum = 0;
+	auto count = 0;
+	for (const auto* value : map)
+	{
+		sum += *value;
+		count++;
+	}
+
+	auto expectedSum = 0;
+	auto expectedCount = 0;
+	for (auto i = 0; i < 100; i++)
+	{
+		if (i % 3 != 0)
+		{
+			expectedSum += i;
+			expectedCount++;
+			EXPECT_EQ(map.Get(handles[i]), values[i].get());
+		}
+	}
+	EXPECT_EQ(sum, expectedSum);
+	EXPECT_EQ(count, expectedCount);
+}
+
+TEST(SlotMapTests, RemovesExpired)
+{
+	SlotMap<int> map;
+	const auto kept = std::make_shared<int>(1);
+	const auto keptHandle = map.Insert(kept);
+	SlotHandle goneHandle;
+	{
+		const auto gone = std::make_shared<int>(2);
+		goneHandle = map.Insert(gone);
+	}
+
+	EXPECT_EQ(map.Lock(goneHandle), nullptr);
+
+	map.RemoveExpired();
+	EXPECT_EQ(map.size(), 1u);
+	EXPECT_FALSE(map.Contains(goneHandle));
+	EXPECT_EQ(map.Get(keptHandle), kept.get());
+}
@@ -0,0 +1,57 @@
+#include "pch.h"
+#include "MazeGrid.h"
+#include "MazeTestHelpers.h"
+#include "TiledMazeGenerator.h"
+
+using namespace mazer;
+
+TEST(TiledMazeGeneratorTests, GeneratesPerfectMaze)
+{
+	const TiledMazeGenerator generator(150, 200, 1234, 32, 64);
+	const auto grid = generator.GenerateGrid(4);
+
+	EXPECT_EQ(generator.GetTileCount(), 5 * 4);
+	EXPECT_TRUE(tests::HasOuterWalls(*grid));
+	EXPECT_TRUE(tests::IsPerfectMaze(*grid));
+}
+
+TEST(TiledMazeGeneratorTests, TileColumnsAreWordAligned)
+{
+	const TiledMazeGenerator generator(10, 10, 1, 10, 10);
+
+	EXPECT_EQ(generator.GetTileColumns() % MazeGrid::WordBits, 0);
+	EXPECT_EQ(generator.GetTileCount(), 1);
+	EXPECT_TRUE(tests::IsPerfectMaze(*generator.GenerateGrid()));
+}
+
+TEST(TiledMazeGeneratorTests, SameMazeRegardlessOfThreadCount)
+{
+	const TiledMazeGenerator generator(300, 300, 42, 16, 64);
+	const auto singleThreaded = generator.GenerateGrid(1);
+
+	for (const auto threads : { 2u, 3u, 8u })
+	{
+		EXPECT_TRUE(tests::HaveSameWalls(*singleThreaded, *generator.GenerateGrid(threads))) << threads << " threads";
+	}
+}
+
+TEST(TiledMazeGeneratorTests, GeneratingIntoAGridChangesItsVersionOnce)
+{
+	// Several threads write one grid at once, so a thread sanitizer build checks the writes do not race
+	const TiledMazeGenerator generator(256, 512, 7, 32, 64);
+	MazeGrid grid(256, 512);
+	const auto version = grid.GetVersion();
+
+	generator.Generate(grid, 4);
+
+	EXPECT_EQ(grid.GetVersion(), version + 1);
+	EXPECT_TRUE(tests::IsPerfectMaze(grid));
+}
+
+TEST(TiledMazeGeneratorTests, DifferentSeedDifferentMaze)
+{
+	const auto first = TiledMazeGenerator(100, 100, 1).GenerateGrid(2);
+	const auto second = TiledMazeGenerator(100, 100, 2).GenerateGrid(2);
+
+	EXPECT_FALSE(tests::HaveSameWalls(*first, *second));
+}
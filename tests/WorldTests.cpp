@@ -0,0 +1,98 @@
+#include "CharacterBuilder.h"
+#include "Enemy.h"
+#include "GameData.h"
+#include "GameDataManager.h"
+#include "Level.h"
+#include "MazeGrid.h"
+#include "Player.h"
+#include "Room.h"
+#include "RoomGenerator.h"
+#include "RoomInfo.h"
+#include "World.h"
+#include "gtest/gtest.h"
+#include "cppgamelib/resource/ResourceManager.h"
+
+using namespace mazer;
+
+TEST(WorldTests, Default_World_Is_The_Singletons)
+{
+	EXPECT_EQ(&World::Default().Data(), GameData::Get());
+	EXPECT_EQ(&World::Default().Manager(), GameDataManager::Get());
+	EXPECT_EQ(World::Default().Manager().TheGameData(), GameData::Get());
+}
+
+TEST(WorldTests, Worlds_Do_Not_Share_Rooms)
+{
+	GameData::Get()->Clear();
+	World first;
+	World second;
+	EXPECT_NE(&first.Data(), &second.Data());
+	EXPECT_NE(&first.Data(), GameData::Get());
+	EXPECT_EQ(first.Manager().TheGameData(), &first.Data());
+
+	const RoomGenerator generator(100, 100, 3, 3, false);
+	const auto firstRooms = generator.CreateRooms(generator.GenerateGrid(), first);
+	const auto secondRooms = generator.CreateRooms(generator.GenerateGrid(), second);
+	for (const auto& room : firstRooms) { first.Data().AddRoom(room); }
+	for (const auto& room : secondRooms) { second.Data().AddRoom(room); }
+
+	EXPECT_EQ(first.Data().GetRoom(4), firstRooms[4].get());
+	EXPECT_EQ(second.Data().GetRoom(4), secondRooms[4].get());
+	EXPECT_EQ(GameData::Get()->CountRooms(), 0);
+
+	// Each room info finds its neighbours in its own world
+	const RoomInfo firstInfo(firstRooms[4], first);
+	const RoomInfo secondInfo(secondRooms[4], second);
+	EXPECT_EQ(firstInfo.GetTopRoom(), firstRooms[1].get());
+	EXPECT_EQ(secondInfo.GetTopRoom(), secondRooms[1].get());
+	EXPECT_EQ(&firstRooms[4]->GetWorld(), &first);
+}
+
+TEST(WorldTests, Built_Player_Belongs_To_Its_World)
+{
+	gamelib::ResourceManager::Get()->Initialize("Resources.xml");
+	World world;
+	const auto room = std::make_shared<Room>("MyRoom", "Room", 1, 0, 0, 0, 0, false, world);
+	world.Data().AddRoom(room);
+
+	const auto defaultPlayer = GameData::Get()->GetPlayer();
+	const auto player = CharacterBuilder::BuildPlayer("MyPlayer", room, 188, "StuNick", world);
+
+	EXPECT_EQ(world.Data().GetPlayer(), player);
+	EXPECT_EQ(GameData::Get()->GetPlayer(), defaultPlayer);
+	EXPECT_EQ(&player->GetWorld(), &world);
+	EXPECT_EQ(player->CurrentRoom->GetCurrentRoom(), room.get());
+}
+
+TEST(WorldTests, Worlds_Load_Levels_From_Their_Own_Seeds)
+{
+	gamelib::ResourceManager::Get()->Initialize("Resources.xml");
+	World first;
+	World second;
+	World firstAgain;
+
+	const auto load = [](World& world, const std::uint64_t seed)
+		{
+			const auto level = std::make_shared<Level>(world);
+			level->Seed = seed;
+			level->Load();
+			return level;
+		};
+	const auto enemyDirection = [](const std::shared_ptr<Level>& level)
+		{
+			const auto enemy = std::dynamic_pointer_cast<Enemy>(level->BuildObject("Enemy1", "Enemy", 18, level->Rooms[0]));
+			return enemy->GetPlacement().Direction;
+		};
+
+	// Loading a level in one world does not change what is random about the level of another
+	const auto firstLevel = load(first, 1111);
+	const auto secondLevel = load(second, 2222);
+	const auto firstDirection = enemyDirection(firstLevel);
+	const auto firstAgainLevel = load(firstAgain, 1111);
+	enemyDirection(secondLevel);
+
+	EXPECT_EQ(firstAgainLevel->Grid->GetHorizontalWords(), firstLevel->Grid->GetHorizontalWords());
+	EXPECT_EQ(firstAgainLevel->Grid->GetVerticalWords(), firstLevel->Grid->GetVerticalWords());
+	EXPECT_EQ(enemyDirection(firstAgainLevel), firstDirection);
+	EXPECT_NE(secondLevel->Grid->GetVerticalWords(), firstLevel->Grid->GetVerticalWords());
+}
@@ -0,0 +1,154 @@
+#include "pch.h"
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "XmlStreamReader.h"
+
+using namespace mazer;
+
+namespace
+{
+	// Records the elements it is given as text, e.g. "<room number=1>" and "</room>"
+	class RecordingHandler final : public IXmlStreamHandler
+	{
+	public:
+		void OnStartElement(const std::string_view name, const XmlAttributes& attributes) override
+		{
+			auto text = "<" + std::string(name);
+			for (auto i = 0u; i < attributes.GetCount(); i++)
+			{
+				text += " " + std::string(attributes[i].first) + "=" + std::string(attributes[i].second);
+			}
+			Elements.push_back(text + ">");
+		}
+
+		void OnEndElement(const std::string_view name) override { Elements.push_back("</" + std::string(name) + ">"); }
+
+		std::vector<std::string> Elements;
+	};
+
+	std::vector<std::string> Parse(const std::string& xml, const std::size_t chunkSize = XmlStreamReader::DefaultChunkSize)
+	{
+		std::istringstream input(xml);
+		RecordingHandler handler;
+		XmlStreamReader reader(chunkSize);
+		EXPECT_TRUE(reader.Parse(input, handler)) << reader.GetError();
+		return handler.Elements;
+	}
+}
+
+TEST(XmlStreamReaderTests, ReportsElementsInOrder)
+{
+	const auto elements = Parse(
+		"\xEF\xBB\xBF<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+		"<!-- A level -->\n"
+		"<level cols=\"2\" rows='1'>\n"
+		"  <room number=\"0\" top=\"True\">\n"
+		"    <object name=\"a > b\" type=\"Pickup\"><property name=\"value\" value=\"5\"/></object>\n"
+		"  </room>\n"
+		"  <room number=\"1\" />\n"
+		"</level>\n");
+
+	const std::vector<std::string> expected =
+	{
+		"<level cols=2 rows=1>",
+		"<room number=0 top=True>",
+		"<object name=a > b type=Pickup>",
+		"<property name=value value=5>",
+		"</property>",
+		"</object>",
+		"</room>",
+		"<room number=1>",
+		"</room>",
+		"</level>"
+	};
+	EXPECT_EQ(elements, expected);
+}
+
+TEST(XmlStreamReaderTests, TagsCanSpanChunks)
+{
+	std::string xml = "<level>";
+	for (auto i = 0; i < 200; i++)
+	{
+		xml += "<room number=\"" + std::to_string(i) + "\" top=\"True\" right=\"False\" bottom=\"True\" left=\"False\" />";
+	}
+	xml += "<!-- a comment that is longer than a chunk of sixteen characters --></level>";
+
+	// Chunks much smaller than a tag still read every element
+	const auto small = Parse(xml, 16);
+	const auto large = Parse(xml);
+
+	EXPECT_EQ(small.size(), 2u + 200u * 2u);
+	EXPECT_EQ(small, large);
+	EXPECT_EQ(small[2 * 150 + 1], "<room number=150 top=True right=False bottom=True left=False>");
+}
+
+TEST(XmlStreamReaderTests, DecodesEntities)
+{
+	const auto elements = Parse("<a text=\"&lt;b&gt; &amp; &quot;c&quot; &apos;d&apos; &unknown;\" />");
+
+	ASSERT_EQ(elements.size(), 2u);
+	EXPECT_EQ(elements[0], "<a text=<b> & \"c\" 'd' &unknown;>");
+}
+
+TEST(XmlStreamReaderTests, Attributes)
+{
+	class Handler final : public IXmlStreamHandler
+	{
+	public:
+		void OnStartElement(std::string_view, const XmlAttributes& attributes) override
+		{
+			EXPECT_EQ(attributes.GetInt("cols"), 10);
+			EXPECT_EQ(attributes.GetInt("missing", 7), 7);
+			EXPECT_EQ(attributes.GetUnsigned64("seed"), 18446744073709551615ull);
+			EXPECT_TRUE(attributes.GetBool("autoPopulatePickups"));
+			EXPECT_FALSE(attributes.GetBool("other", true));
+			EXPECT_TRUE(attributes.GetBool("missing", true));
+			EXPECT_TRUE(attributes.Has("cols"));
+			EXPECT_FALSE(attributes.Has("missing"));
+			Count++;
+		}
+
+		int Count = 0;
+	} handler;
+
+	std::istringstream input("<level cols=\"10\" seed=\"18446744073709551615\" autoPopulatePickups=\"TRUE\" other=\"False\"/>");
+	EXPECT_TRUE(XmlStreamReader().Parse(input, handler));
+	EXPECT_EQ(handler.Count, 1);
+}
+
+TEST(XmlStreamReaderTests, ReportsErrors)
+{
+	RecordingHandler handler;
+	XmlStreamReader reader;
+
+	std::istringstream unterminated("<level><room number=\"1\"");
+	EXPECT_FALSE(reader.Parse(unterminated, handler));
+	EXPECT_FALSE(reader.GetError().empty());
+
+	std::istringstream unquoted("<level cols=10>");
+	EXPECT_FALSE(reader.Parse(unquoted, handler));
+
+	EXPECT_FALSE(reader.ParseFile("DoesNotExist.xml", handler));
+}
+
+TEST(XmlStreamReaderTests, ReadsLevelFile)
+{
+	RecordingHandler handler;
+	XmlStreamReader reader(256);
+
+	ASSERT_TRUE(reader.ParseFile("Level1.xml", handler)) << reader.GetError();
+
+	const auto count = [&](const std::string& prefix)
+	{
+		return std::count_if(handler.Elements.begin(), handler.Elements.end(),
+			[&](const std::string& element) { return element.rfind(prefix, 0) == 0; });
+	};
+
+	EXPECT_EQ(handler.Elements.front(), "<level cols=10 rows=10 autoPopulatePickups=False>");
+	EXPECT_EQ(count("<room "), 100);
+	EXPECT_EQ(count("<object "), 12);
+	EXPECT_EQ(count("<property "), 145);
+}
@@ -0,0 +1,28 @@
+#include <iostream>
+
+#include "LevelBaker.h"
+
+// Bakes XML levels into binary levels: MazerLevelBaker <level.xml> <level.mzl> [<level.xml> <level.mzl> ...]
+int main(const int argc, char* argv[])
+{
+	if (argc < 3 || argc % 2 == 0)
+	{
+		std::cerr << "Usage: MazerLevelBaker <level.xml> <level.mzl> [<level.xml> <level.mzl> ...]\n";
+		return 1;
+	}
+
+	auto result = 0;
+	for (auto i = 1; i < argc; i += 2)
+	{
+		if (mazer::LevelBaker::Bake(argv[i], argv[i + 1]))
+		{
+			std::cout << "Baked " << argv[i] << " into " << argv[i + 1] << '\n';
+		}
+		else
+		{
+			std::cerr << "Could not bake " << argv[i] << '\n';
+			result = 1;
+		}
+	}
+	return result;
+}
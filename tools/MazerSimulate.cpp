@@ -0,0 +1,38 @@
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <cppgamelib/resource/ResourceManager.h>
+
+#include "Level.h"
+#include "Simulation.h"
+
+// Runs a level without a window and reports ticks per second:
+// MazerSimulate <level.xml|level.mzl> [ticks] [seed] [player sprite resource id]
+int main(const int argc, char* argv[])
+{
+	if (argc < 2)
+	{
+		std::cerr << "Usage: MazerSimulate <level.xml|level.mzl> [ticks] [seed] [player sprite resource id]\n";
+		return 1;
+	}
+
+	const auto ticks = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10000ull;
+	const auto seed = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 1ull;
+	const auto playerResourceId = argc > 4 ? std::atoi(argv[4]) : -1;
+
+	gamelib::ResourceManager::Get()->Initialize("Resources.xml");
+
+	mazer::Simulation simulation(std::make_shared<mazer::Level>(argv[1]));
+	simulation.Load();
+
+	if (playerResourceId >= 0 && simulation.GetLevel()->Player1 == nullptr)
+	{
+		simulation.SpawnPlayer(playerResourceId);
+	}
+	simulation.SetInput(mazer::Simulation::RandomInput(seed));
+
+	const auto report = simulation.Run(ticks);
+	std::cout << report.Ticks << " ticks (" << report.SimulatedMs << "ms of game time) in " << report.Seconds << "s: "
+		<< report.TicksPerSecond() << " ticks/s\n";
+	return 0;
+}